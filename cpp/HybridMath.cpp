@@ -123,20 +123,9 @@ double HybridMath::complexAbsolute(const std::tuple<double, double>& a) {
     return std::sqrt(real * real + imag * imag);
 }
 
-// === HELPER METHODS ===
-void HybridMath::validateMatrix(const std::vector<std::vector<double>>& matrix) {
-    if (matrix.empty()) throw std::runtime_error("Matrix is empty");
-    size_t cols = matrix[0].size();
-    for (const auto& row : matrix) {
-        if (row.size() != cols) {
-            throw std::runtime_error("Matrix has inconsistent row sizes");
-        }
-    }
-}
-
-bool HybridMath::isSquareMatrix(const std::vector<std::vector<double>>& matrix) {
-    validateMatrix(matrix);
-    return matrix.size() == matrix[0].size();
+
+double HybridMath::cancelPendingTasks() {
+    return static_cast<double>(_tasks.cancelPending());
 }
 
 } // namespace margelo::nitro::rnmath
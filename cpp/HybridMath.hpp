@@ -1,22 +1,40 @@
 #pragma once
 
 #include "HybridMathSpec.hpp"
+#include "signal/FFT.hpp"
+#include "utils/TaskQueue.hpp"
 #include <vector>
 #include <array>
 #include <tuple>
 #include <optional>
 #include <memory>
+#include <mutex>
 
 namespace margelo::nitro::rnmath {
 
+class HybridRandomGenerator;
+
 class HybridMath : public HybridMathSpec {
 private:
 
     inline static constexpr auto TAG = "Math";
 
-    // Helper methods
-    void validateMatrix(const std::vector<std::vector<double>>& matrix);
-    bool isSquareMatrix(const std::vector<std::vector<double>>& matrix);
+    // Bounded LRU caches of FFT plans shared by the signal processing methods,
+    // one set per sample precision
+    dsp::FFTPlanCache _fftPlans;
+    dsp::RealFFTPlanCache _realFftPlans;
+    dsp::FloatFFTPlanCache _floatFftPlans;
+    dsp::FloatRealFFTPlanCache _floatRealFftPlans;
+    // Generator behind randomUniform/randomNormal, seeded from the OS on first
+    // use. The Math object can be called from several JS runtimes at once
+    // (worklets on other threads), so creating it and drawing from it both
+    // happen under _randomMutex.
+    std::shared_ptr<HybridRandomGenerator> _random;
+    std::mutex _randomMutex;
+    HybridRandomGenerator& sharedRandom();
+    // Background queue for the *Async methods. Declared last so it is
+    // destroyed first, before the state its jobs may still be using.
+    TaskQueue _tasks;
 
 public:
     HybridMath();
@@ -81,6 +99,9 @@ public:
     double vectorStandardDeviation(const std::vector<double>& vector, std::optional<bool> population) override;
     double vectorMin(const std::vector<double>& vector) override;
     double vectorMax(const std::vector<double>& vector) override;
+    std::vector<double> vectorMap(ElementwiseFunction fn, const std::vector<double>& vector) override;
+    std::vector<double> vectorPow(const std::vector<double>& vector, double exponent) override;
+    std::shared_ptr<HybridExpressionSpec> compileExpression(const std::vector<ExpressionNode>& nodes) override;
     
 
     std::vector<std::vector<double>> matrixCreate(const std::vector<std::vector<double>>& elements) override;
@@ -95,29 +116,96 @@ public:
     double matrixDeterminant(const std::vector<std::vector<double>>& matrix) override;
     std::vector<std::vector<double>> matrixInverse(const std::vector<std::vector<double>>& matrix) override;
     double matrixTrace(const std::vector<std::vector<double>>& matrix) override;
+    std::vector<double> matrixSolve(const std::vector<std::vector<double>>& A, const std::vector<double>& b) override;
+    std::shared_ptr<HybridFactorizationSpec> factorize(const std::vector<std::vector<double>>& matrix, std::optional<FactorizationKind> kind) override;
+    std::shared_ptr<HybridNativeArraySpec> createNativeArray(const std::shared_ptr<ArrayBuffer>& data, double rows, double cols, std::optional<DType> dtype) override;
+    std::shared_ptr<HybridNativeArraySpec> nativeArrayFromVector(const std::vector<double>& vector, std::optional<DType> dtype) override;
+    std::shared_ptr<HybridNativeArraySpec> nativeArrayFromMatrix(const std::vector<std::vector<double>>& matrix, std::optional<DType> dtype) override;
+    std::shared_ptr<HybridNativeArraySpec> nativeArrayZeros(double rows, double cols, std::optional<DType> dtype) override;
     
 
     double mean(const std::vector<double>& data) override;
     double median(const std::vector<double>& data) override;
+    std::vector<double> quantiles(const std::vector<double>& data, const std::vector<double>& probabilities) override;
     double variance(const std::vector<double>& data, std::optional<bool> population) override;
     double standardDeviation(const std::vector<double>& data, std::optional<bool> population) override;
     double covariance(const std::vector<double>& a, const std::vector<double>& b) override;
     double correlation(const std::vector<double>& a, const std::vector<double>& b) override;
+    SummaryStatistics describe(const std::vector<double>& data, std::optional<bool> population) override;
     
 
     double normalPDF(double x, std::optional<double> mean, std::optional<double> stddev) override;
     double normalCDF(double x, std::optional<double> mean, std::optional<double> stddev) override;
+    std::shared_ptr<HybridDistributionSpec> createDistribution(DistributionKind kind, const std::optional<std::vector<double>>& params) override;
     
 
     std::vector<double> randomUniform(double count, std::optional<double> min, std::optional<double> max) override;
     std::vector<double> randomNormal(double count, std::optional<double> mean, std::optional<double> stddev) override;
+    std::shared_ptr<HybridRandomGeneratorSpec> createRandomGenerator(std::optional<double> seed) override;
     
 
     std::tuple<std::vector<double>, std::vector<double>> fft(const std::vector<double>& real, const std::vector<double>& imag) override;
-    std::vector<double> convolve(const std::vector<double>& signal, const std::vector<double>& kernel) override;
+    std::tuple<std::vector<double>, std::vector<double>> ifft(const std::vector<double>& real, const std::vector<double>& imag) override;
+    std::tuple<std::vector<double>, std::vector<double>> rfft(const std::vector<double>& signal) override;
+    std::vector<double> irfft(const std::vector<double>& real, const std::vector<double>& imag, std::optional<double> size) override;
+    std::shared_ptr<HybridFFTPlanSpec> createFFTPlan(double size, std::optional<bool> inverse) override;
+    std::vector<double> convolve(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) override;
+    std::shared_ptr<HybridFilterSpec> createFIRFilter(const std::vector<double>& taps) override;
+    std::shared_ptr<HybridFilterSpec> createBiquadFilter(const std::vector<std::vector<double>>& sections) override;
+    
+
+    std::vector<double> linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) override;
+    std::vector<double> linearRegressionPredict(const std::vector<std::vector<double>>& X, const std::vector<double>& coefficients) override;
+    std::shared_ptr<HybridOnlineRegressionSpec> createOnlineRegression(double features, std::optional<double> forgetting, std::optional<double> ridge) override;
+    std::shared_ptr<HybridNeuralNetworkSpec> createNeuralNetwork(const std::vector<DenseLayer>& layers) override;
+    
+
+    double vectorDotProductBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) override;
+    double vectorNormBuffer(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) override;
+    double vectorSumBuffer(const std::shared_ptr<ArrayBuffer>& vector) override;
+    std::shared_ptr<ArrayBuffer> vectorAddBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorSubtractBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorScaleBuffer(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorMapBuffer(ElementwiseFunction fn, const std::shared_ptr<ArrayBuffer>& vector, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorPowBuffer(const std::shared_ptr<ArrayBuffer>& vector, double exponent, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> matrixMultiplyBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> matrixTransposeBuffer(const std::shared_ptr<ArrayBuffer>& matrix, double rows, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> fftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) override;
+    std::shared_ptr<ArrayBuffer> convolveBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) override;
+    std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> rfftBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) override;
+    std::shared_ptr<ArrayBuffer> irfftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::vector<double> linearRegressionBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y, double features, std::optional<double> ridge, std::optional<RegressionMethod> method) override;
+    std::shared_ptr<ArrayBuffer> linearRegressionPredictBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::vector<double>& coefficients, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    KMeansResult kmeansBuffer(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) override;
+    SummaryStatistics describeBuffer(const std::shared_ptr<ArrayBuffer>& data, std::optional<bool> population) override;
+    std::vector<double> quantilesBuffer(const std::shared_ptr<ArrayBuffer>& data, const std::vector<double>& probabilities, std::optional<bool> inPlace) override;
+    
+
+    double vectorDotProductBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) override;
+    double vectorNormBufferF32(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) override;
+    double vectorSumBufferF32(const std::shared_ptr<ArrayBuffer>& vector) override;
+    std::shared_ptr<ArrayBuffer> vectorAddBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorSubtractBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> vectorScaleBufferF32(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> matrixMultiplyBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> fftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) override;
+    std::shared_ptr<ArrayBuffer> convolveBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) override;
+    std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> rfftBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) override;
+    std::shared_ptr<ArrayBuffer> irfftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
     
 
-    std::vector<double> linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y) override;
+    std::shared_ptr<Promise<std::vector<std::vector<double>>>> matrixMultiplyAsync(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) override;
+    std::shared_ptr<Promise<std::vector<std::vector<double>>>> matrixInverseAsync(const std::vector<std::vector<double>>& matrix) override;
+    std::shared_ptr<Promise<std::vector<double>>> matrixSolveAsync(const std::vector<std::vector<double>>& A, const std::vector<double>& b) override;
+    std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> fftAsync(const std::vector<double>& real, const std::vector<double>& imag) override;
+    std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> ifftAsync(const std::vector<double>& real, const std::vector<double>& imag) override;
+    std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> rfftAsync(const std::vector<double>& signal) override;
+    std::shared_ptr<Promise<std::vector<double>>> convolveAsync(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) override;
+    std::shared_ptr<Promise<std::vector<double>>> linearRegressionAsync(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) override;
+    std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> matrixMultiplyBufferAsync(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols) override;
+    std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> convolveBufferAsync(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, std::optional<ConvolutionMode> mode) override;
+    std::shared_ptr<Promise<KMeansResult>> kmeansBufferAsync(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) override;
+    double cancelPendingTasks() override;
     
 
     double factorial(double n) override;
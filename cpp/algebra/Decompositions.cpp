@@ -0,0 +1,356 @@
+#include "Decompositions.hpp"
+#include "Gemm.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace margelo::nitro::rnmath::linalg {
+
+// Columns per panel; the trailing update is a GEMM with this inner dimension
+static constexpr size_t LU_BLOCK = 64;
+
+
+LU::LU(ConstMatrixView a) : _lu(Matrix::copyOf(a)), _pivots(a.rows) {
+    if (!a.isSquare()) {
+        throw std::runtime_error("LU decomposition requires a square matrix");
+    }
+
+    size_t n = a.rows;
+    double max_abs = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) max_abs = std::max(max_abs, std::fabs(a(i, j)));
+    }
+    double tolerance = static_cast<double>(n) * std::numeric_limits<double>::epsilon() * max_abs;
+
+    MatrixView lu = _lu.view();
+    for (size_t k0 = 0; k0 < n; k0 += LU_BLOCK) {
+        size_t nb = std::min(LU_BLOCK, n - k0);
+        size_t k1 = k0 + nb;
+
+        // Unblocked factorization of the panel lu[k0:n, k0:k1]. Row swaps are
+        // applied across the full width so the factors stay consistent.
+        for (size_t k = k0; k < k1; k++) {
+            size_t pivot = k;
+            double best = std::fabs(lu(k, k));
+            for (size_t i = k + 1; i < n; i++) {
+                double v = std::fabs(lu(i, k));
+                if (v > best) {
+                    best = v;
+                    pivot = i;
+                }
+            }
+            _pivots[k] = pivot;
+            if (pivot != k) {
+                std::swap_ranges(lu.row(k), lu.row(k) + n, lu.row(pivot));
+                _oddPermutation = !_oddPermutation;
+            }
+
+            if (best <= tolerance) {
+                // Nothing to eliminate with: zero the column and carry on
+                _singular = true;
+                for (size_t i = k + 1; i < n; i++) lu(i, k) = 0.0;
+                continue;
+            }
+
+            double inv_pivot = 1.0 / lu(k, k);
+            const double* rk = lu.row(k);
+            for (size_t i = k + 1; i < n; i++) {
+                double* ri = lu.row(i);
+                double l = ri[k] * inv_pivot;
+                ri[k] = l;
+                for (size_t j = k + 1; j < k1; j++) {
+                    ri[j] -= l * rk[j];
+                }
+            }
+        }
+
+        if (k1 == n) break;
+
+        // U12 = L11^-1 * A12, row by row since L11 is unit lower triangular
+        for (size_t i = k0 + 1; i < k1; i++) {
+            double* ri = lu.row(i);
+            for (size_t r = k0; r < i; r++) {
+                double l = ri[r];
+                const double* rr = lu.row(r);
+                for (size_t j = k1; j < n; j++) {
+                    ri[j] -= l * rr[j];
+                }
+            }
+        }
+
+        // A22 -= L21 * U12
+        gemm(lu.block(k1, k0, n - k1, nb), lu.block(k0, k1, nb, n - k1), lu.block(k1, k1, n - k1, n - k1), -1.0, 1.0);
+    }
+}
+
+double LU::determinant() const {
+    if (_singular) return 0.0;
+
+    double det = _oddPermutation ? -1.0 : 1.0;
+    for (size_t i = 0; i < size(); i++) {
+        det *= _lu(i, i);
+    }
+    return det;
+}
+
+void LU::solve(MatrixView b) const {
+    if (_singular) {
+        throw std::runtime_error("Matrix is singular, cannot solve");
+    }
+    size_t n = size();
+    if (b.rows != n) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(b.rows) + " rows, expected " + std::to_string(n));
+    }
+    size_t k = b.cols;
+
+    for (size_t i = 0; i < n; i++) {
+        if (_pivots[i] != i) {
+            std::swap_ranges(b.row(i), b.row(i) + k, b.row(_pivots[i]));
+        }
+    }
+
+    // Forward substitution with unit-diagonal L
+    for (size_t i = 1; i < n; i++) {
+        const double* li = _lu.row(i);
+        double* bi = b.row(i);
+        for (size_t r = 0; r < i; r++) {
+            double l = li[r];
+            if (l == 0.0) continue;
+            const double* br = b.row(r);
+            for (size_t j = 0; j < k; j++) bi[j] -= l * br[j];
+        }
+    }
+
+    // Back substitution with U
+    for (size_t i = n; i-- > 0;) {
+        const double* ui = _lu.row(i);
+        double* bi = b.row(i);
+        for (size_t r = i + 1; r < n; r++) {
+            double u = ui[r];
+            if (u == 0.0) continue;
+            const double* br = b.row(r);
+            for (size_t j = 0; j < k; j++) bi[j] -= u * br[j];
+        }
+        double inv = 1.0 / ui[i];
+        for (size_t j = 0; j < k; j++) bi[j] *= inv;
+    }
+}
+
+void LU::solve(ConstMatrixView b, MatrixView x) const {
+    if (b.rows != size()) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(b.rows) + " rows, expected " + std::to_string(size()));
+    }
+    if (x.data != b.data) {
+        for (size_t i = 0; i < b.rows; i++) std::copy_n(b.row(i), b.cols, x.row(i));
+    }
+    solve(x);
+}
+
+Matrix LU::inverse() const {
+    Matrix result = Matrix::identity(size());
+    solve(result);
+    return result;
+}
+
+size_t LU::memorySize() const {
+    return _lu.size() * sizeof(double) + _pivots.size() * sizeof(size_t);
+}
+
+
+Cholesky::Cholesky(ConstMatrixView a) : _l(a.rows, a.cols) {
+    if (!a.isSquare()) {
+        throw std::runtime_error("Cholesky decomposition requires a square matrix");
+    }
+
+    size_t n = a.rows;
+    // Each pivot is compared with its own diagonal entry, so rescaling a
+    // variable does not change whether the matrix factors
+    double tolerance = static_cast<double>(n) * std::numeric_limits<double>::epsilon();
+
+    // Row-by-row (Cholesky-Banachiewicz): every entry is one contiguous dot
+    // product of two already computed rows of L
+    for (size_t i = 0; i < n; i++) {
+        double* li = _l.row(i);
+        for (size_t j = 0; j <= i; j++) {
+            const double* lj = _l.row(j);
+            double sum = a(i, j);
+            for (size_t k = 0; k < j; k++) {
+                sum -= li[k] * lj[k];
+            }
+
+            if (i == j) {
+                if (!(sum > tolerance * a(i, i))) {
+                    throw std::runtime_error("Matrix is not positive definite");
+                }
+                li[i] = std::sqrt(sum);
+            } else {
+                li[j] = sum / lj[j];
+            }
+        }
+    }
+}
+
+void Cholesky::solve(ConstMatrixView b, MatrixView x) const {
+    size_t n = rows();
+    if (b.rows != n) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(b.rows) + " rows, expected " + std::to_string(n));
+    }
+    size_t k = b.cols;
+    if (x.data != b.data) {
+        for (size_t i = 0; i < n; i++) std::copy_n(b.row(i), k, x.row(i));
+    }
+
+    // L * Y = B
+    for (size_t i = 0; i < n; i++) {
+        const double* li = _l.row(i);
+        double* xi = x.row(i);
+        for (size_t r = 0; r < i; r++) {
+            const double* xr = x.row(r);
+            for (size_t j = 0; j < k; j++) xi[j] -= li[r] * xr[j];
+        }
+        double inv = 1.0 / li[i];
+        for (size_t j = 0; j < k; j++) xi[j] *= inv;
+    }
+
+    // L^T * X = Y, eliminating with row i of L once x_i is known
+    for (size_t i = n; i-- > 0;) {
+        const double* li = _l.row(i);
+        double* xi = x.row(i);
+        double inv = 1.0 / li[i];
+        for (size_t j = 0; j < k; j++) xi[j] *= inv;
+        for (size_t r = 0; r < i; r++) {
+            double* xr = x.row(r);
+            for (size_t j = 0; j < k; j++) xr[j] -= li[r] * xi[j];
+        }
+    }
+}
+
+double Cholesky::determinant() const {
+    double det = 1.0;
+    for (size_t i = 0; i < rows(); i++) {
+        det *= _l(i, i);
+    }
+    return det * det;
+}
+
+size_t Cholesky::memorySize() const {
+    return _l.size() * sizeof(double);
+}
+
+
+QR::QR(ConstMatrixView a) : _qr(Matrix::copyOf(a)), _tau(a.cols, 0.0) {
+    size_t m = a.rows, n = a.cols;
+    if (m < n) {
+        throw std::runtime_error("QR decomposition requires at least as many rows as columns");
+    }
+
+    // A column is dependent when what is left of it after the previous
+    // reflections is rounding noise relative to its own original norm
+    std::vector<double> tolerance(n, 0.0);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) tolerance[j] += a(i, j) * a(i, j);
+    }
+    for (double& t : tolerance) t = static_cast<double>(m) * std::numeric_limits<double>::epsilon() * std::sqrt(t);
+
+    std::vector<double> w(n);
+    for (size_t j = 0; j < n; j++) {
+        double norm2 = 0.0;
+        for (size_t i = j; i < m; i++) norm2 += _qr(i, j) * _qr(i, j);
+        double norm = std::sqrt(norm2);
+
+        if (norm <= tolerance[j]) {
+            _rankDeficient = true;
+            continue;
+        }
+
+        // Reflector H = I - tau * v * v^T with v[j] = 1 maps column j onto beta * e_j
+        double alpha = _qr(j, j);
+        double beta = alpha > 0.0 ? -norm : norm;
+        double scale = 1.0 / (alpha - beta);
+        for (size_t i = j + 1; i < m; i++) _qr(i, j) *= scale;
+        _qr(j, j) = beta;
+        double tau = (beta - alpha) / beta;
+        _tau[j] = tau;
+
+        // Apply H to the trailing columns: w = v^T * A, A -= tau * v * w
+        std::fill(w.begin() + j + 1, w.end(), 0.0);
+        for (size_t i = j; i < m; i++) {
+            double vi = (i == j) ? 1.0 : _qr(i, j);
+            const double* ri = _qr.row(i);
+            for (size_t c = j + 1; c < n; c++) w[c] += vi * ri[c];
+        }
+        for (size_t i = j; i < m; i++) {
+            double vi = tau * ((i == j) ? 1.0 : _qr(i, j));
+            double* ri = _qr.row(i);
+            for (size_t c = j + 1; c < n; c++) ri[c] -= vi * w[c];
+        }
+    }
+}
+
+void QR::solve(ConstMatrixView b, MatrixView x) const {
+    if (_rankDeficient) {
+        throw std::runtime_error("Matrix is rank deficient, cannot solve");
+    }
+    size_t m = rows(), n = cols();
+    if (b.rows != m) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(b.rows) + " rows, expected " + std::to_string(m));
+    }
+    size_t k = b.cols;
+
+    // Q^T * B, one reflector at a time
+    Matrix qtb = Matrix::copyOf(b);
+    std::vector<double> w(k);
+    for (size_t j = 0; j < n; j++) {
+        double tau = _tau[j];
+        if (tau == 0.0) continue;
+
+        std::fill(w.begin(), w.end(), 0.0);
+        for (size_t i = j; i < m; i++) {
+            double vi = (i == j) ? 1.0 : _qr(i, j);
+            const double* bi = qtb.row(i);
+            for (size_t c = 0; c < k; c++) w[c] += vi * bi[c];
+        }
+        for (size_t i = j; i < m; i++) {
+            double vi = tau * ((i == j) ? 1.0 : _qr(i, j));
+            double* bi = qtb.row(i);
+            for (size_t c = 0; c < k; c++) bi[c] -= vi * w[c];
+        }
+    }
+
+    // R * X = (Q^T * B)[0:n]
+    for (size_t i = n; i-- > 0;) {
+        const double* ri = _qr.row(i);
+        double* yi = qtb.row(i);
+        for (size_t r = i + 1; r < n; r++) {
+            const double* yr = qtb.row(r);
+            for (size_t c = 0; c < k; c++) yi[c] -= ri[r] * yr[c];
+        }
+        double inv = 1.0 / ri[i];
+        for (size_t c = 0; c < k; c++) yi[c] *= inv;
+    }
+
+    for (size_t i = 0; i < n; i++) std::copy_n(qtb.row(i), k, x.row(i));
+}
+
+double QR::determinant() const {
+    if (rows() != cols()) {
+        throw std::runtime_error("Determinant requires a square matrix");
+    }
+    if (_rankDeficient) return 0.0;
+
+    // Every applied reflector has determinant -1
+    double det = 1.0;
+    for (size_t j = 0; j < cols(); j++) {
+        det *= _qr(j, j);
+        if (_tau[j] != 0.0) det = -det;
+    }
+    return det;
+}
+
+size_t QR::memorySize() const {
+    return (_qr.size() + _tau.size()) * sizeof(double);
+}
+
+} // namespace margelo::nitro::rnmath::linalg
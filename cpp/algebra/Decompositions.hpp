@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::linalg {
+
+// A matrix factored once so that many right-hand sides can be solved in
+// O(n^2) each. Solving never modifies the factors, so it is safe to call
+// concurrently.
+class Factorization {
+public:
+    virtual ~Factorization() = default;
+
+    // Shape of the factored matrix A
+    virtual size_t rows() const = 0;
+    virtual size_t cols() const = 0;
+
+    // Writes X with A * X = B (least squares for tall QR), B is rows() x k and
+    // X is cols() x k. `x` may be `b` itself when A is square.
+    virtual void solve(ConstMatrixView b, MatrixView x) const = 0;
+    virtual double determinant() const = 0;
+
+    virtual size_t memorySize() const = 0;
+};
+
+// LU factorization with partial pivoting, P * A = L * U, of a square matrix.
+// Right-looking and blocked: each panel of columns is factored unblocked, and
+// the trailing submatrix is updated with one GEMM per panel.
+// L (unit diagonal) and U are stored together in one n x n matrix.
+class LU : public Factorization {
+public:
+    explicit LU(ConstMatrixView a);
+
+    size_t size() const { return _lu.rows(); }
+    size_t rows() const override { return size(); }
+    size_t cols() const override { return size(); }
+
+    // A pivot at or below n * eps * max|A| counts as zero
+    bool isSingular() const { return _singular; }
+    // 0 for singular matrices
+    double determinant() const override;
+
+    // Overwrites the n x k right-hand sides `b` with the solution of A * X = B.
+    // Throws for singular matrices.
+    void solve(MatrixView b) const;
+    void solve(ConstMatrixView b, MatrixView x) const override;
+    Matrix inverse() const;
+
+    const Matrix& factors() const { return _lu; }
+    // Row i of P * A is row pivots()[i] of A, applied as successive swaps
+    const std::vector<size_t>& pivots() const { return _pivots; }
+
+    size_t memorySize() const override;
+
+private:
+    Matrix _lu;
+    std::vector<size_t> _pivots;
+    bool _oddPermutation = false;
+    bool _singular = false;
+};
+
+// Cholesky factorization A = L * L^T of a symmetric positive definite matrix.
+// Only the lower triangle of A is read. Throws if A is not positive definite,
+// counting a pivot at or below n * eps * max|A_ii| as zero.
+class Cholesky : public Factorization {
+public:
+    explicit Cholesky(ConstMatrixView a);
+
+    size_t rows() const override { return _l.rows(); }
+    size_t cols() const override { return _l.rows(); }
+
+    void solve(ConstMatrixView b, MatrixView x) const override;
+    double determinant() const override;
+
+    const Matrix& factor() const { return _l; }
+    size_t memorySize() const override;
+
+private:
+    Matrix _l;
+};
+
+// Householder QR factorization A = Q * R of an m x n matrix with m >= n.
+// R is kept in the upper triangle, the reflectors below it. Solving a tall
+// system returns its least-squares solution.
+class QR : public Factorization {
+public:
+    explicit QR(ConstMatrixView a);
+
+    size_t rows() const override { return _qr.rows(); }
+    size_t cols() const override { return _qr.cols(); }
+
+    // A diagonal entry of R at or below max(m, n) * eps * max|A| counts as zero
+    bool isRankDeficient() const { return _rankDeficient; }
+
+    void solve(ConstMatrixView b, MatrixView x) const override;
+    // Square matrices only
+    double determinant() const override;
+
+    size_t memorySize() const override;
+
+private:
+    Matrix _qr;
+    std::vector<double> _tau;
+    bool _rankDeficient = false;
+};
+
+} // namespace margelo::nitro::rnmath::linalg
@@ -0,0 +1,277 @@
+#include "Expression.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <cmath>
+
+namespace margelo::nitro::rnmath::linalg {
+
+// Elements per block; a few scratch blocks stay in L1
+static constexpr size_t EXPR_BLOCK = 512;
+// Reductions sum fixed chunks in order, so results do not depend on the thread count
+static constexpr size_t EXPR_CHUNK = 32 * EXPR_BLOCK;
+static constexpr size_t EXPR_MAX_NODES = 256;
+static constexpr size_t EXPR_MAX_INPUTS = 64;
+
+static size_t arity(Expression::Op op) {
+    switch (op) {
+        case Expression::Op::Input:
+        case Expression::Op::Constant:
+            return 0;
+        case Expression::Op::Negate:
+        case Expression::Op::Map:
+        case Expression::Op::Pow:
+            return 1;
+        default:
+            return 2;
+    }
+}
+
+// NaN in either operand gives NaN, like Math.min and Math.max
+static inline double minOf(double a, double b) { return a < b || std::isnan(a) ? a : b; }
+static inline double maxOf(double a, double b) { return a > b || std::isnan(a) ? a : b; }
+
+static double applyScalar(const Expression::Node& node, double a, double b) {
+    double r = 0.0;
+    switch (node.op) {
+        case Expression::Op::Add: return a + b;
+        case Expression::Op::Subtract: return a - b;
+        case Expression::Op::Multiply: return a * b;
+        case Expression::Op::Divide: return a / b;
+        case Expression::Op::Min: return minOf(a, b);
+        case Expression::Op::Max: return maxOf(a, b);
+        case Expression::Op::Negate: return -a;
+        case Expression::Op::Map: vmath::map(node.fn, &a, &r, 1); return r;
+        case Expression::Op::Pow: vmath::power(&a, node.value, &r, 1); return r;
+        default: return node.value;
+    }
+}
+
+// One operand may be a scalar, passed as a null pointer and its value
+template <typename F>
+static void binaryBlock(const double* a, double sa, const double* b, double sb, double* out, size_t n, F f) {
+    if (!a) {
+        for (size_t i = 0; i < n; i++) out[i] = f(sa, b[i]);
+    } else if (!b) {
+        for (size_t i = 0; i < n; i++) out[i] = f(a[i], sb);
+    } else {
+        for (size_t i = 0; i < n; i++) out[i] = f(a[i], b[i]);
+    }
+}
+
+Expression::Expression(const std::vector<Node>& nodes) : _nodes(nodes.size()) {
+    size_t n = nodes.size();
+    if (n == 0) throw std::runtime_error("Expression must have at least one node");
+    if (n > EXPR_MAX_NODES) throw std::runtime_error("Expression must have at most " + std::to_string(EXPR_MAX_NODES) + " nodes");
+
+    for (size_t i = 0; i < n; i++) {
+        const Node& node = nodes[i];
+        size_t k = arity(node.op);
+        if ((k >= 1 && node.a >= i) || (k == 2 && node.b >= i)) {
+            throw std::runtime_error("Expression node " + std::to_string(i) + " must only use earlier nodes");
+        }
+        if (node.op == Op::Input) {
+            double slot = node.value;
+            if (!(slot >= 0.0 && slot < EXPR_MAX_INPUTS) || slot != std::floor(slot)) {
+                throw std::runtime_error("Expression input index must be an integer below " + std::to_string(EXPR_MAX_INPUTS));
+            }
+            _inputs = std::max(_inputs, static_cast<size_t>(slot) + 1);
+        }
+    }
+
+    // Only nodes reachable from the result are evaluated
+    std::vector<bool> used(n, false);
+    used[n - 1] = true;
+    for (size_t i = n; i-- > 0;) {
+        if (!used[i]) continue;
+        size_t k = arity(nodes[i].op);
+        if (k >= 1) used[nodes[i].a] = true;
+        if (k == 2) used[nodes[i].b] = true;
+    }
+
+    // Steps initially refer to operands by node index
+    std::vector<Operand> operands(n);
+    for (size_t i = 0; i < n; i++) {
+        if (!used[i]) continue;
+        const Node& node = nodes[i];
+        switch (node.op) {
+            case Op::Input:
+                operands[i] = {Operand::Kind::Input, static_cast<size_t>(node.value), 0.0};
+                break;
+            case Op::Constant:
+                operands[i] = {Operand::Kind::Scalar, 0, node.value};
+                break;
+            default: {
+                size_t k = arity(node.op);
+                Operand a = operands[node.a];
+                Operand b = k == 2 ? operands[node.b] : Operand{};
+                if (a.kind == Operand::Kind::Scalar && b.kind == Operand::Kind::Scalar) {
+                    operands[i] = {Operand::Kind::Scalar, 0, applyScalar(node, a.value, b.value)};
+                } else {
+                    _steps.push_back({node.op, a, b, i, node.value, node.fn});
+                    operands[i] = {Operand::Kind::Slot, i, 0.0};
+                }
+                break;
+            }
+        }
+    }
+    _result = operands[n - 1];
+    if (_result.kind == Operand::Kind::Scalar) {
+        throw std::runtime_error("Expression must depend on at least one input");
+    }
+
+    // Scratch blocks are released after their last use, and element-wise
+    // steps may write over an operand they are reading
+    std::vector<size_t> last_use(n, 0);
+    for (size_t k = 0; k < _steps.size(); k++) {
+        if (_steps[k].a.kind == Operand::Kind::Slot) last_use[_steps[k].a.index] = k;
+        if (_steps[k].b.kind == Operand::Kind::Slot) last_use[_steps[k].b.index] = k;
+    }
+
+    std::vector<size_t> slot_of(n, 0);
+    std::vector<size_t> free_slots;
+    for (size_t k = 0; k < _steps.size(); k++) {
+        Step& step = _steps[k];
+        size_t released = n;
+        for (Operand* operand : {&step.a, &step.b}) {
+            if (operand->kind != Operand::Kind::Slot) continue;
+            size_t node = operand->index;
+            operand->index = slot_of[node];
+            if (last_use[node] == k && node != released) {
+                free_slots.push_back(slot_of[node]);
+                released = node;
+            }
+        }
+
+        size_t node = step.dst;
+        if (free_slots.empty()) {
+            step.dst = _slots++;
+        } else {
+            step.dst = free_slots.back();
+            free_slots.pop_back();
+        }
+        slot_of[node] = step.dst;
+    }
+    if (_result.kind == Operand::Kind::Slot) _result.index = slot_of[_result.index];
+}
+
+const double* Expression::runBlock(const std::vector<const double*>& inputs, size_t begin, size_t n, double* scratch, double* out) const {
+    auto ptr = [&](const Operand& o) -> const double* {
+        switch (o.kind) {
+            case Operand::Kind::Input: return inputs[o.index] + begin;
+            case Operand::Kind::Slot: return scratch + o.index * EXPR_BLOCK;
+            default: return nullptr;
+        }
+    };
+
+    for (size_t k = 0; k < _steps.size(); k++) {
+        const Step& s = _steps[k];
+        double* dst = out && k + 1 == _steps.size() ? out : scratch + s.dst * EXPR_BLOCK;
+        const double* a = ptr(s.a);
+        const double* b = ptr(s.b);
+        switch (s.op) {
+            case Op::Add: binaryBlock(a, s.a.value, b, s.b.value, dst, n, [](double x, double y) { return x + y; }); break;
+            case Op::Subtract: binaryBlock(a, s.a.value, b, s.b.value, dst, n, [](double x, double y) { return x - y; }); break;
+            case Op::Multiply: binaryBlock(a, s.a.value, b, s.b.value, dst, n, [](double x, double y) { return x * y; }); break;
+            case Op::Divide: binaryBlock(a, s.a.value, b, s.b.value, dst, n, [](double x, double y) { return x / y; }); break;
+            case Op::Min: binaryBlock(a, s.a.value, b, s.b.value, dst, n, minOf); break;
+            case Op::Max: binaryBlock(a, s.a.value, b, s.b.value, dst, n, maxOf); break;
+            case Op::Negate:
+                for (size_t i = 0; i < n; i++) dst[i] = -a[i];
+                break;
+            case Op::Map: vmath::map(s.fn, a, dst, n); break;
+            case Op::Pow: vmath::power(a, s.exponent, dst, n); break;
+            default: break;
+        }
+    }
+
+    if (_result.kind == Operand::Kind::Input) return inputs[_result.index] + begin;
+    return out ? out : scratch + _result.index * EXPR_BLOCK;
+}
+
+static void checkInputs(const std::vector<const double*>& inputs, size_t expected) {
+    if (inputs.size() != expected) {
+        throw std::runtime_error("Expression expects " + std::to_string(expected) + " inputs, got " + std::to_string(inputs.size()));
+    }
+}
+
+void Expression::evaluate(const std::vector<const double*>& inputs, double* out, size_t n) const {
+    checkInputs(inputs, _inputs);
+
+    ThreadPool& pool = ThreadPool::shared();
+    pool.parallelFor(n, pool.grainFor(n, EXPR_CHUNK), [&](size_t begin, size_t end) {
+        std::vector<double> scratch(_slots * EXPR_BLOCK);
+        for (size_t i = begin; i < end; i += EXPR_BLOCK) {
+            size_t len = std::min(EXPR_BLOCK, end - i);
+            const double* r = runBlock(inputs, i, len, scratch.data(), out + i);
+            if (r != out + i) std::copy(r, r + len, out + i);
+        }
+    });
+}
+
+double Expression::reduce(const std::vector<const double*>& inputs, size_t n, Reduction reduction) const {
+    checkInputs(inputs, _inputs);
+    if (n == 0) {
+        if (reduction == Reduction::Min || reduction == Reduction::Max) {
+            throw std::runtime_error("Cannot find min or max of an empty expression");
+        }
+        return 0.0;
+    }
+
+    // Sum, Mean and Norm accumulate in `acc`; Min and Max keep the running value
+    size_t chunks = (n + EXPR_CHUNK - 1) / EXPR_CHUNK;
+    std::vector<double> partials(chunks);
+    ThreadPool::shared().parallelFor(chunks, 1, [&](size_t c0, size_t c1) {
+        std::vector<double> scratch(_slots * EXPR_BLOCK);
+        for (size_t c = c0; c < c1; c++) {
+            size_t end = std::min(n, (c + 1) * EXPR_CHUNK);
+            double acc[4] = {0.0, 0.0, 0.0, 0.0};
+            double extreme = reduction == Reduction::Min ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+            for (size_t i = c * EXPR_CHUNK; i < end; i += EXPR_BLOCK) {
+                size_t len = std::min(EXPR_BLOCK, end - i);
+                const double* r = runBlock(inputs, i, len, scratch.data(), nullptr);
+                switch (reduction) {
+                    case Reduction::Min:
+                        for (size_t j = 0; j < len; j++) extreme = minOf(extreme, r[j]);
+                        break;
+                    case Reduction::Max:
+                        for (size_t j = 0; j < len; j++) extreme = maxOf(extreme, r[j]);
+                        break;
+                    case Reduction::Norm: {
+                        size_t j = 0;
+                        for (; j + 4 <= len; j += 4) {
+                            for (size_t l = 0; l < 4; l++) acc[l] += r[j + l] * r[j + l];
+                        }
+                        for (; j < len; j++) acc[0] += r[j] * r[j];
+                        break;
+                    }
+                    default: {
+                        size_t j = 0;
+                        for (; j + 4 <= len; j += 4) {
+                            for (size_t l = 0; l < 4; l++) acc[l] += r[j + l];
+                        }
+                        for (; j < len; j++) acc[0] += r[j];
+                        break;
+                    }
+                }
+            }
+            bool extremum = reduction == Reduction::Min || reduction == Reduction::Max;
+            partials[c] = extremum ? extreme : (acc[0] + acc[1]) + (acc[2] + acc[3]);
+        }
+    });
+
+    switch (reduction) {
+        case Reduction::Min: return std::accumulate(partials.begin() + 1, partials.end(), partials[0], minOf);
+        case Reduction::Max: return std::accumulate(partials.begin() + 1, partials.end(), partials[0], maxOf);
+        default: break;
+    }
+    double sum = std::accumulate(partials.begin(), partials.end(), 0.0);
+    if (reduction == Reduction::Mean) return sum / static_cast<double>(n);
+    if (reduction == Reduction::Norm) return std::sqrt(sum);
+    return sum;
+}
+
+} // namespace margelo::nitro::rnmath::linalg
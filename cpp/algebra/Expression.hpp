@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../utils/VectorMath.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::linalg {
+
+// An element-wise expression over equally long input arrays, such as
+// (a + b) * s or exp(-x * x). Evaluation is one fused pass: the nodes run one
+// after another over cache-sized blocks, so no full-length intermediates
+// are allocated and every input is read once.
+class Expression {
+public:
+    enum class Op { Input, Constant, Add, Subtract, Multiply, Divide, Min, Max, Negate, Map, Pow };
+    enum class Reduction { Sum, Mean, Min, Max, Norm };
+
+    // Operands refer to earlier nodes; the last node is the result
+    struct Node {
+        Op op = Op::Constant;
+        size_t a = 0;
+        size_t b = 0;
+        // Input slot for Input, the value for Constant, the exponent for Pow
+        double value = 0.0;
+        vmath::Function fn = vmath::Function::Abs;
+    };
+
+    // Validates the graph, folds constant subexpressions, drops nodes the
+    // result does not use and assigns reusable scratch blocks to the rest
+    explicit Expression(const std::vector<Node>& nodes);
+
+    // Number of input arrays the expression reads
+    size_t inputCount() const { return _inputs; }
+    size_t nodeCount() const { return _nodes; }
+
+    // out[i] = expression(inputs[0][i], inputs[1][i], ...). `out` may be
+    // one of the inputs.
+    void evaluate(const std::vector<const double*>& inputs, double* out, size_t n) const;
+
+    // Reduces the expression's values without storing them
+    double reduce(const std::vector<const double*>& inputs, size_t n, Reduction reduction) const;
+
+private:
+    struct Operand {
+        enum class Kind { Slot, Input, Scalar } kind = Kind::Scalar;
+        size_t index = 0;
+        double value = 0.0;
+    };
+
+    struct Step {
+        Op op;
+        Operand a;
+        Operand b;
+        size_t dst;
+        double exponent;
+        vmath::Function fn;
+    };
+
+    // Runs all steps over [begin, begin + n) and returns the result block.
+    // The last step writes to `out` instead of scratch when it is given.
+    const double* runBlock(const std::vector<const double*>& inputs, size_t begin, size_t n, double* scratch, double* out) const;
+
+    std::vector<Step> _steps;
+    Operand _result;
+    size_t _inputs = 0;
+    size_t _slots = 0;
+    size_t _nodes = 0;
+};
+
+} // namespace margelo::nitro::rnmath::linalg
@@ -0,0 +1,537 @@
+#include "Gemm.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define RNMATH_GEMM_NEON 1
+#elif (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define RNMATH_GEMM_X86 1
+#endif
+
+namespace margelo::nitro::rnmath::linalg {
+
+// Blocking parameters: a KC x NC panel of `b` stays in L2/L3, an MC x KC
+// panel of `a` in L2 and one KC x NR sliver of `b` in L1 while the
+// micro-kernel sweeps over it. MC is a multiple of every kernel's MR.
+static constexpr size_t KC = 256;
+static constexpr size_t MC = 96;
+static constexpr size_t NC = 2048;
+
+// Below this many multiply-adds packing costs more than it saves
+static constexpr size_t SMALL_GEMM_FLOPS = 32 * 32 * 32;
+// Below this many multiply-adds the product stays on the calling thread
+static constexpr size_t PARALLEL_GEMM_FLOPS = 128 * 128 * 128;
+
+// Largest MR * NR over all kernels, for the edge-tile scratch buffer
+static constexpr size_t MAX_TILE = 6 * 16;
+
+// Computes an MR x NR tile from packed panels: `a` holds MR values per k,
+// `b` holds NR values per k. The tile is stored to `c` with row stride `ldc`,
+// overwriting it unless `accumulate` is set.
+template <typename T>
+using MicroKernelFn = void (*)(size_t kc, const T* a, const T* b, T* c, size_t ldc, bool accumulate);
+
+template <typename T>
+struct MicroKernel {
+    size_t mr;
+    size_t nr;
+    MicroKernelFn<T> run;
+    const char* name;
+};
+
+
+template <typename T>
+static void kernelScalar(size_t kc, const T* a, const T* b, T* c, size_t ldc, bool accumulate) {
+    constexpr size_t MR = 4, NR = 4;
+    T acc[MR][NR] = {};
+
+    for (size_t p = 0; p < kc; p++) {
+        for (size_t i = 0; i < MR; i++) {
+            T ai = a[i];
+            for (size_t j = 0; j < NR; j++) {
+                acc[i][j] += ai * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+
+    for (size_t i = 0; i < MR; i++) {
+        T* ci = c + i * ldc;
+        for (size_t j = 0; j < NR; j++) {
+            ci[j] = accumulate ? ci[j] + acc[i][j] : acc[i][j];
+        }
+    }
+}
+
+#if RNMATH_GEMM_NEON
+// 4 x 8 tile: 16 accumulators of two doubles, out of 32 vector registers
+static void kernelNeon(size_t kc, const double* a, const double* b, double* c, size_t ldc, bool accumulate) {
+    float64x2_t c00 = vdupq_n_f64(0.0), c01 = c00, c02 = c00, c03 = c00;
+    float64x2_t c10 = c00, c11 = c00, c12 = c00, c13 = c00;
+    float64x2_t c20 = c00, c21 = c00, c22 = c00, c23 = c00;
+    float64x2_t c30 = c00, c31 = c00, c32 = c00, c33 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        float64x2_t b0 = vld1q_f64(b), b1 = vld1q_f64(b + 2), b2 = vld1q_f64(b + 4), b3 = vld1q_f64(b + 6);
+        float64x2_t a01 = vld1q_f64(a), a23 = vld1q_f64(a + 2);
+
+        c00 = vfmaq_laneq_f64(c00, b0, a01, 0); c01 = vfmaq_laneq_f64(c01, b1, a01, 0);
+        c02 = vfmaq_laneq_f64(c02, b2, a01, 0); c03 = vfmaq_laneq_f64(c03, b3, a01, 0);
+        c10 = vfmaq_laneq_f64(c10, b0, a01, 1); c11 = vfmaq_laneq_f64(c11, b1, a01, 1);
+        c12 = vfmaq_laneq_f64(c12, b2, a01, 1); c13 = vfmaq_laneq_f64(c13, b3, a01, 1);
+        c20 = vfmaq_laneq_f64(c20, b0, a23, 0); c21 = vfmaq_laneq_f64(c21, b1, a23, 0);
+        c22 = vfmaq_laneq_f64(c22, b2, a23, 0); c23 = vfmaq_laneq_f64(c23, b3, a23, 0);
+        c30 = vfmaq_laneq_f64(c30, b0, a23, 1); c31 = vfmaq_laneq_f64(c31, b1, a23, 1);
+        c32 = vfmaq_laneq_f64(c32, b2, a23, 1); c33 = vfmaq_laneq_f64(c33, b3, a23, 1);
+
+        a += 4;
+        b += 8;
+    }
+
+    auto store = [&](double* ci, float64x2_t v0, float64x2_t v1, float64x2_t v2, float64x2_t v3) {
+        if (accumulate) {
+            v0 = vaddq_f64(v0, vld1q_f64(ci));
+            v1 = vaddq_f64(v1, vld1q_f64(ci + 2));
+            v2 = vaddq_f64(v2, vld1q_f64(ci + 4));
+            v3 = vaddq_f64(v3, vld1q_f64(ci + 6));
+        }
+        vst1q_f64(ci, v0);
+        vst1q_f64(ci + 2, v1);
+        vst1q_f64(ci + 4, v2);
+        vst1q_f64(ci + 6, v3);
+    };
+    store(c, c00, c01, c02, c03);
+    store(c + ldc, c10, c11, c12, c13);
+    store(c + 2 * ldc, c20, c21, c22, c23);
+    store(c + 3 * ldc, c30, c31, c32, c33);
+}
+
+// 8 x 8 tile: 16 accumulators of four floats, out of 32 vector registers
+static void kernelNeonFloat(size_t kc, const float* a, const float* b, float* c, size_t ldc, bool accumulate) {
+    float32x4_t c00 = vdupq_n_f32(0.0f), c01 = c00, c10 = c00, c11 = c00;
+    float32x4_t c20 = c00, c21 = c00, c30 = c00, c31 = c00;
+    float32x4_t c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+    float32x4_t c60 = c00, c61 = c00, c70 = c00, c71 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        float32x4_t b0 = vld1q_f32(b), b1 = vld1q_f32(b + 4);
+        float32x4_t a03 = vld1q_f32(a), a47 = vld1q_f32(a + 4);
+
+        c00 = vfmaq_laneq_f32(c00, b0, a03, 0); c01 = vfmaq_laneq_f32(c01, b1, a03, 0);
+        c10 = vfmaq_laneq_f32(c10, b0, a03, 1); c11 = vfmaq_laneq_f32(c11, b1, a03, 1);
+        c20 = vfmaq_laneq_f32(c20, b0, a03, 2); c21 = vfmaq_laneq_f32(c21, b1, a03, 2);
+        c30 = vfmaq_laneq_f32(c30, b0, a03, 3); c31 = vfmaq_laneq_f32(c31, b1, a03, 3);
+        c40 = vfmaq_laneq_f32(c40, b0, a47, 0); c41 = vfmaq_laneq_f32(c41, b1, a47, 0);
+        c50 = vfmaq_laneq_f32(c50, b0, a47, 1); c51 = vfmaq_laneq_f32(c51, b1, a47, 1);
+        c60 = vfmaq_laneq_f32(c60, b0, a47, 2); c61 = vfmaq_laneq_f32(c61, b1, a47, 2);
+        c70 = vfmaq_laneq_f32(c70, b0, a47, 3); c71 = vfmaq_laneq_f32(c71, b1, a47, 3);
+
+        a += 8;
+        b += 8;
+    }
+
+    auto store = [&](float* ci, float32x4_t v0, float32x4_t v1) {
+        if (accumulate) {
+            v0 = vaddq_f32(v0, vld1q_f32(ci));
+            v1 = vaddq_f32(v1, vld1q_f32(ci + 4));
+        }
+        vst1q_f32(ci, v0);
+        vst1q_f32(ci + 4, v1);
+    };
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+    store(c + 6 * ldc, c60, c61);
+    store(c + 7 * ldc, c70, c71);
+}
+#endif
+
+#if RNMATH_GEMM_X86
+// 4 x 4 tile: 8 accumulators of two doubles, out of 16 xmm registers
+__attribute__((target("sse2")))
+static void kernelSse2(size_t kc, const double* a, const double* b, double* c, size_t ldc, bool accumulate) {
+    __m128d c00 = _mm_setzero_pd(), c01 = c00;
+    __m128d c10 = c00, c11 = c00;
+    __m128d c20 = c00, c21 = c00;
+    __m128d c30 = c00, c31 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        __m128d b0 = _mm_loadu_pd(b), b1 = _mm_loadu_pd(b + 2);
+        __m128d ai;
+        ai = _mm_set1_pd(a[0]); c00 = _mm_add_pd(c00, _mm_mul_pd(ai, b0)); c01 = _mm_add_pd(c01, _mm_mul_pd(ai, b1));
+        ai = _mm_set1_pd(a[1]); c10 = _mm_add_pd(c10, _mm_mul_pd(ai, b0)); c11 = _mm_add_pd(c11, _mm_mul_pd(ai, b1));
+        ai = _mm_set1_pd(a[2]); c20 = _mm_add_pd(c20, _mm_mul_pd(ai, b0)); c21 = _mm_add_pd(c21, _mm_mul_pd(ai, b1));
+        ai = _mm_set1_pd(a[3]); c30 = _mm_add_pd(c30, _mm_mul_pd(ai, b0)); c31 = _mm_add_pd(c31, _mm_mul_pd(ai, b1));
+        a += 4;
+        b += 4;
+    }
+
+    auto store = [&](double* ci, __m128d v0, __m128d v1) {
+        if (accumulate) {
+            v0 = _mm_add_pd(v0, _mm_loadu_pd(ci));
+            v1 = _mm_add_pd(v1, _mm_loadu_pd(ci + 2));
+        }
+        _mm_storeu_pd(ci, v0);
+        _mm_storeu_pd(ci + 2, v1);
+    };
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+}
+
+// 4 x 8 tile: 8 accumulators of four floats, out of 16 xmm registers
+__attribute__((target("sse2")))
+static void kernelSse2Float(size_t kc, const float* a, const float* b, float* c, size_t ldc, bool accumulate) {
+    __m128 c00 = _mm_setzero_ps(), c01 = c00;
+    __m128 c10 = c00, c11 = c00;
+    __m128 c20 = c00, c21 = c00;
+    __m128 c30 = c00, c31 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        __m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b + 4);
+        __m128 ai;
+        ai = _mm_set1_ps(a[0]); c00 = _mm_add_ps(c00, _mm_mul_ps(ai, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(ai, b1));
+        ai = _mm_set1_ps(a[1]); c10 = _mm_add_ps(c10, _mm_mul_ps(ai, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(ai, b1));
+        ai = _mm_set1_ps(a[2]); c20 = _mm_add_ps(c20, _mm_mul_ps(ai, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(ai, b1));
+        ai = _mm_set1_ps(a[3]); c30 = _mm_add_ps(c30, _mm_mul_ps(ai, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(ai, b1));
+        a += 4;
+        b += 8;
+    }
+
+    auto store = [&](float* ci, __m128 v0, __m128 v1) {
+        if (accumulate) {
+            v0 = _mm_add_ps(v0, _mm_loadu_ps(ci));
+            v1 = _mm_add_ps(v1, _mm_loadu_ps(ci + 4));
+        }
+        _mm_storeu_ps(ci, v0);
+        _mm_storeu_ps(ci + 4, v1);
+    };
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+}
+
+__attribute__((target("avx2,fma")))
+static inline void storeRowAvx2(double* ci, __m256d v0, __m256d v1, bool accumulate) {
+    if (accumulate) {
+        v0 = _mm256_add_pd(v0, _mm256_loadu_pd(ci));
+        v1 = _mm256_add_pd(v1, _mm256_loadu_pd(ci + 4));
+    }
+    _mm256_storeu_pd(ci, v0);
+    _mm256_storeu_pd(ci + 4, v1);
+}
+
+// 6 x 8 tile: 12 accumulators of four doubles, out of 16 ymm registers
+__attribute__((target("avx2,fma")))
+static void kernelAvx2(size_t kc, const double* a, const double* b, double* c, size_t ldc, bool accumulate) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = c00;
+    __m256d c10 = c00, c11 = c00;
+    __m256d c20 = c00, c21 = c00;
+    __m256d c30 = c00, c31 = c00;
+    __m256d c40 = c00, c41 = c00;
+    __m256d c50 = c00, c51 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4);
+        __m256d ai;
+        ai = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(ai, b0, c00); c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(ai, b0, c10); c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(ai, b0, c20); c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(ai, b0, c30); c31 = _mm256_fmadd_pd(ai, b1, c31);
+        ai = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(ai, b0, c40); c41 = _mm256_fmadd_pd(ai, b1, c41);
+        ai = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(ai, b0, c50); c51 = _mm256_fmadd_pd(ai, b1, c51);
+        a += 6;
+        b += 8;
+    }
+
+    storeRowAvx2(c, c00, c01, accumulate);
+    storeRowAvx2(c + ldc, c10, c11, accumulate);
+    storeRowAvx2(c + 2 * ldc, c20, c21, accumulate);
+    storeRowAvx2(c + 3 * ldc, c30, c31, accumulate);
+    storeRowAvx2(c + 4 * ldc, c40, c41, accumulate);
+    storeRowAvx2(c + 5 * ldc, c50, c51, accumulate);
+}
+
+__attribute__((target("avx2,fma")))
+static inline void storeRowAvx2(float* ci, __m256 v0, __m256 v1, bool accumulate) {
+    if (accumulate) {
+        v0 = _mm256_add_ps(v0, _mm256_loadu_ps(ci));
+        v1 = _mm256_add_ps(v1, _mm256_loadu_ps(ci + 8));
+    }
+    _mm256_storeu_ps(ci, v0);
+    _mm256_storeu_ps(ci + 8, v1);
+}
+
+// 6 x 16 tile: 12 accumulators of eight floats, out of 16 ymm registers
+__attribute__((target("avx2,fma")))
+static void kernelAvx2Float(size_t kc, const float* a, const float* b, float* c, size_t ldc, bool accumulate) {
+    __m256 c00 = _mm256_setzero_ps(), c01 = c00;
+    __m256 c10 = c00, c11 = c00;
+    __m256 c20 = c00, c21 = c00;
+    __m256 c30 = c00, c31 = c00;
+    __m256 c40 = c00, c41 = c00;
+    __m256 c50 = c00, c51 = c00;
+
+    for (size_t p = 0; p < kc; p++) {
+        __m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b + 8);
+        __m256 ai;
+        ai = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(ai, b0, c00); c01 = _mm256_fmadd_ps(ai, b1, c01);
+        ai = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(ai, b0, c10); c11 = _mm256_fmadd_ps(ai, b1, c11);
+        ai = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(ai, b0, c20); c21 = _mm256_fmadd_ps(ai, b1, c21);
+        ai = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(ai, b0, c30); c31 = _mm256_fmadd_ps(ai, b1, c31);
+        ai = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(ai, b0, c40); c41 = _mm256_fmadd_ps(ai, b1, c41);
+        ai = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(ai, b0, c50); c51 = _mm256_fmadd_ps(ai, b1, c51);
+        a += 6;
+        b += 16;
+    }
+
+    storeRowAvx2(c, c00, c01, accumulate);
+    storeRowAvx2(c + ldc, c10, c11, accumulate);
+    storeRowAvx2(c + 2 * ldc, c20, c21, accumulate);
+    storeRowAvx2(c + 3 * ldc, c30, c31, accumulate);
+    storeRowAvx2(c + 4 * ldc, c40, c41, accumulate);
+    storeRowAvx2(c + 5 * ldc, c50, c51, accumulate);
+}
+#endif
+
+static MicroKernel<double> detectKernel() {
+#if RNMATH_GEMM_NEON
+    return {4, 8, kernelNeon, "neon"};
+#elif RNMATH_GEMM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return {6, 8, kernelAvx2, "avx2"};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {4, 4, kernelSse2, "sse2"};
+    }
+    return {4, 4, kernelScalar<double>, "scalar"};
+#else
+    return {4, 4, kernelScalar<double>, "scalar"};
+#endif
+}
+
+// Same selection for float32: each vector holds twice the values, so the
+// tiles are twice as wide for the same register budget
+static MicroKernel<float> detectFloatKernel() {
+#if RNMATH_GEMM_NEON
+    return {8, 8, kernelNeonFloat, "neon"};
+#elif RNMATH_GEMM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return {6, 16, kernelAvx2Float, "avx2"};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {4, 8, kernelSse2Float, "sse2"};
+    }
+    return {4, 4, kernelScalar<float>, "scalar"};
+#else
+    return {4, 4, kernelScalar<float>, "scalar"};
+#endif
+}
+
+template <typename T>
+static const MicroKernel<T>& selectedKernel() {
+    if constexpr (std::is_same_v<T, float>) {
+        static const MicroKernel<float> kernel = detectFloatKernel();
+        return kernel;
+    } else {
+        static const MicroKernel<double> kernel = detectKernel();
+        return kernel;
+    }
+}
+
+const char* gemmKernelName() {
+    return selectedKernel<double>().name;
+}
+
+
+static size_t roundUp(size_t n, size_t multiple) {
+    return (n + multiple - 1) / multiple * multiple;
+}
+
+// Packs rows [i0, i0 + mc) x columns [p0, p0 + kc) of `a`, scaled by
+// `alpha`, into MR-row panels, k-major within a panel. Rows past `mc` are
+// zero-padded.
+template <typename T>
+static void packA(BasicMatrixView<const T> a, T alpha, size_t i0, size_t mc, size_t p0, size_t kc, size_t mr, T* dst) {
+    for (size_t ir = 0; ir < mc; ir += mr) {
+        size_t rows = std::min(mr, mc - ir);
+        for (size_t p = 0; p < kc; p++) {
+            for (size_t r = 0; r < rows; r++) {
+                dst[r] = alpha * a(i0 + ir + r, p0 + p);
+            }
+            for (size_t r = rows; r < mr; r++) {
+                dst[r] = T(0);
+            }
+            dst += mr;
+        }
+    }
+}
+
+// Packs rows [p0, p0 + kc) x columns [j0, j0 + nc) of `b` into NR-column
+// panels, k-major within a panel. Columns past `nc` are zero-padded.
+template <typename T>
+static void packB(BasicMatrixView<const T> b, size_t p0, size_t kc, size_t j0, size_t nc, size_t nr, T* dst) {
+    for (size_t jr = 0; jr < nc; jr += nr) {
+        size_t cols = std::min(nr, nc - jr);
+        for (size_t p = 0; p < kc; p++) {
+            const T* src = b.row(p0 + p) + j0 + jr;
+            std::copy_n(src, cols, dst);
+            std::fill(dst + cols, dst + nr, T(0));
+            dst += nr;
+        }
+    }
+}
+
+// Runs the micro-kernel over an mc x nc block of `out` from packed panels.
+// Edge tiles are computed into a scratch tile and copied out.
+template <typename T>
+static void macroKernel(const MicroKernel<T>& kernel, size_t mc, size_t nc, size_t kc, const T* packed_a, const T* packed_b,
+                        T* c, size_t ldc, bool accumulate) {
+    size_t mr = kernel.mr, nr = kernel.nr;
+    T tile[MAX_TILE];
+
+    for (size_t jr = 0; jr < nc; jr += nr) {
+        size_t cols = std::min(nr, nc - jr);
+        const T* b_panel = packed_b + jr * kc;
+
+        for (size_t ir = 0; ir < mc; ir += mr) {
+            size_t rows = std::min(mr, mc - ir);
+            const T* a_panel = packed_a + ir * kc;
+            T* c_tile = c + ir * ldc + jr;
+
+            if (rows == mr && cols == nr) {
+                kernel.run(kc, a_panel, b_panel, c_tile, ldc, accumulate);
+                continue;
+            }
+
+            kernel.run(kc, a_panel, b_panel, tile, nr, false);
+            for (size_t i = 0; i < rows; i++) {
+                for (size_t j = 0; j < cols; j++) {
+                    T v = tile[i * nr + j];
+                    c_tile[i * ldc + j] = accumulate ? c_tile[i * ldc + j] + v : v;
+                }
+            }
+        }
+    }
+}
+
+// i-k-j loop for products too small to amortize packing
+template <typename T>
+static void gemmSmall(BasicMatrixView<const T> a, T alpha, BasicMatrixView<const T> b, BasicMatrixView<T> out, bool accumulate) {
+    for (size_t i = 0; i < a.rows; i++) {
+        T* ro = out.row(i);
+        if (!accumulate) std::fill_n(ro, out.cols, T(0));
+
+        const T* ra = a.row(i);
+        for (size_t k = 0; k < a.cols; k++) {
+            T aik = alpha * ra[k];
+            const T* rb = b.row(k);
+            for (size_t j = 0; j < b.cols; j++) {
+                ro[j] += aik * rb[j];
+            }
+        }
+    }
+}
+
+template <typename T>
+static void gemmBlocked(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out, T alpha, T beta, const BasicGemmEpilogue<T>& epilogue) {
+    size_t M = a.rows, K = a.cols, N = b.cols;
+    if (M == 0 || N == 0) return;
+
+    // The kernels either overwrite `out` or add to it; any other beta is applied up front
+    if (beta != T(0) && beta != T(1)) {
+        for (size_t i = 0; i < M; i++) {
+            T* ro = out.row(i);
+            for (size_t j = 0; j < N; j++) ro[j] *= beta;
+        }
+    }
+    bool accumulate = beta != T(0);
+
+    if (K == 0 || alpha == T(0)) {
+        if (!accumulate) {
+            for (size_t i = 0; i < M; i++) std::fill_n(out.row(i), N, T(0));
+        }
+        if (epilogue) epilogue(out, 0, 0);
+        return;
+    }
+    // A single row is a matrix-vector product: streaming `b` once beats
+    // packing it for a micro-kernel that would mostly multiply padding
+    if (M * N * K <= SMALL_GEMM_FLOPS || M == 1) {
+        gemmSmall(a, alpha, b, out, accumulate);
+        if (epilogue) epilogue(out, 0, 0);
+        return;
+    }
+
+    const MicroKernel<T>& kernel = selectedKernel<T>();
+    size_t mr = kernel.mr, nr = kernel.nr;
+
+    ThreadPool& pool = ThreadPool::shared();
+    size_t threads = M * N * K >= PARALLEL_GEMM_FLOPS ? pool.concurrency() : 1;
+
+    // Tasks are (row block, column slice) tiles of each packed panel of `b`.
+    // Shrink the row blocks, then slice columns, until every thread has work.
+    size_t mc_block = std::min(MC, roundUp((M + threads - 1) / threads, mr));
+    size_t row_blocks = (M + mc_block - 1) / mc_block;
+
+    size_t nc_max = std::min(NC, N);
+    size_t kc_max = std::min(KC, K);
+    std::vector<T> packed_b(roundUp(nc_max, nr) * kc_max);
+
+    for (size_t jc = 0; jc < N; jc += NC) {
+        size_t nc = std::min(NC, N - jc);
+        size_t col_slices = std::min((threads + row_blocks - 1) / row_blocks, (nc + nr - 1) / nr);
+        size_t slice = roundUp((nc + col_slices - 1) / col_slices, nr);
+        col_slices = (nc + slice - 1) / slice;
+
+        for (size_t pc = 0; pc < K; pc += KC) {
+            size_t kc = std::min(KC, K - pc);
+            // The first k-block overwrites `out` unless the caller accumulates
+            bool acc = accumulate || pc > 0;
+            bool last = pc + KC >= K;
+            packB(b, pc, kc, jc, nc, nr, packed_b.data());
+
+            auto task = [&](size_t t0, size_t t1) {
+                // Each thread packs its own panels of `a`, reused across calls
+                static thread_local std::vector<T> packed_a;
+                packed_a.resize(roundUp(mc_block, mr) * kc);
+
+                for (size_t t = t0; t < t1; t++) {
+                    size_t ic = (t / col_slices) * mc_block;
+                    size_t j0 = (t % col_slices) * slice;
+                    size_t mc = std::min(mc_block, M - ic);
+                    size_t cols = std::min(slice, nc - j0);
+
+                    packA(a, alpha, ic, mc, pc, kc, mr, packed_a.data());
+                    macroKernel(kernel, mc, cols, kc, packed_a.data(), packed_b.data() + j0 * kc, out.row(ic) + jc + j0, out.stride, acc);
+                    if (last && epilogue) {
+                        epilogue(out.block(ic, jc + j0, mc, cols), ic, jc + j0);
+                    }
+                }
+            };
+            size_t tasks = row_blocks * col_slices;
+            pool.parallelFor(tasks, threads > 1 ? 1 : tasks, task);
+        }
+    }
+}
+
+void gemm(ConstMatrixView a, ConstMatrixView b, MatrixView out, double alpha, double beta, const GemmEpilogue& epilogue) {
+    gemmBlocked<double>(a, b, out, alpha, beta, epilogue);
+}
+
+void gemm(ConstFloatMatrixView a, ConstFloatMatrixView b, FloatMatrixView out, float alpha, float beta, const FloatGemmEpilogue& epilogue) {
+    gemmBlocked<float>(a, b, out, alpha, beta, epilogue);
+}
+
+} // namespace margelo::nitro::rnmath::linalg
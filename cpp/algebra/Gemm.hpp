@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include <functional>
+
+namespace margelo::nitro::rnmath::linalg {
+
+// out = alpha * a * b + beta * out. With beta = 0 `out` is only written,
+// never read, so it may hold garbage.
+// Cache-blocked GEMM: panels of `b` and `a` are packed into contiguous
+// buffers sized for L2/L1 and fed to a register-blocked micro-kernel. The
+// micro-kernel is picked once at runtime: NEON on arm64, AVX2+FMA or SSE2
+// on x86, otherwise portable scalar code. Small products skip packing and
+// large ones are split by tile across the shared ThreadPool.
+// `out` must not alias the inputs.
+// `epilogue`, when set, is called once on every finished block of `out`
+// while it is still in cache, with the block's offset in `out`. Blocks are
+// disjoint and may be handed to it from several threads at once.
+template <typename T>
+using BasicGemmEpilogue = std::function<void(BasicMatrixView<T> block, size_t row0, size_t col0)>;
+using GemmEpilogue = BasicGemmEpilogue<double>;
+using FloatGemmEpilogue = BasicGemmEpilogue<float>;
+
+void gemm(ConstMatrixView a, ConstMatrixView b, MatrixView out, double alpha = 1.0, double beta = 0.0, const GemmEpilogue& epilogue = nullptr);
+// Single precision, with the same blocking over float micro-kernels whose
+// tiles hold twice the values per register
+void gemm(ConstFloatMatrixView a, ConstFloatMatrixView b, FloatMatrixView out, float alpha = 1.0f, float beta = 0.0f, const FloatGemmEpilogue& epilogue = nullptr);
+
+// Name of the micro-kernel selected for this CPU, for diagnostics
+const char* gemmKernelName();
+
+} // namespace margelo::nitro::rnmath::linalg
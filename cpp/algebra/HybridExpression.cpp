@@ -0,0 +1,90 @@
+#include "HybridExpression.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+HybridExpression::HybridExpression(std::unique_ptr<const linalg::Expression> expression) : HybridObject(TAG), _expression(std::move(expression)) { }
+
+static linalg::Expression::Reduction toReduction(ExpressionReduction reduction) {
+    switch (reduction) {
+        case ExpressionReduction::MEAN: return linalg::Expression::Reduction::Mean;
+        case ExpressionReduction::MIN: return linalg::Expression::Reduction::Min;
+        case ExpressionReduction::MAX: return linalg::Expression::Reduction::Max;
+        case ExpressionReduction::NORM: return linalg::Expression::Reduction::Norm;
+        default: return linalg::Expression::Reduction::Sum;
+    }
+}
+
+// Pointers to equally long inputs; returns their common length
+static size_t collectInputs(const std::vector<std::vector<double>>& inputs, std::vector<const double*>& data) {
+    for (const auto& input : inputs) {
+        if (input.size() != inputs[0].size()) {
+            throw std::runtime_error("Expression inputs must have the same length");
+        }
+        data.push_back(input.data());
+    }
+    return inputs.empty() ? 0 : inputs[0].size();
+}
+
+static size_t collectInputs(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, std::vector<Float64Buffer>& views, std::vector<const double*>& data) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+        views.push_back(asFloat64(inputs[i], ("inputs[" + std::to_string(i) + "]").c_str()));
+        if (views.back().size != views[0].size) {
+            throw std::runtime_error("Expression inputs must have the same length");
+        }
+        data.push_back(views.back().data);
+    }
+    return views.empty() ? 0 : views[0].size;
+}
+
+
+double HybridExpression::getInputs() {
+    return static_cast<double>(_expression->inputCount());
+}
+
+double HybridExpression::getNodes() {
+    return static_cast<double>(_expression->nodeCount());
+}
+
+std::vector<double> HybridExpression::evaluate(const std::vector<std::vector<double>>& inputs) {
+    std::vector<const double*> data;
+    size_t n = collectInputs(inputs, data);
+
+    std::vector<double> result(n);
+    _expression->evaluate(data, result.data(), n);
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridExpression::evaluateBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    std::vector<Float64Buffer> views;
+    std::vector<const double*> data;
+    size_t n = collectInputs(inputs, views, data);
+
+    auto result = outputFloat64(out, n);
+    Float64Buffer vr = asFloat64(result, "out");
+    for (const Float64Buffer& v : views) {
+        if (vr.data != v.data && overlaps(vr, v)) {
+            throw std::runtime_error("Output buffer must be one of the inputs or not overlap them");
+        }
+    }
+
+    _expression->evaluate(data, vr.data, n);
+    return result;
+}
+
+double HybridExpression::reduce(const std::vector<std::vector<double>>& inputs, ExpressionReduction reduction) {
+    std::vector<const double*> data;
+    size_t n = collectInputs(inputs, data);
+    return _expression->reduce(data, n, toReduction(reduction));
+}
+
+double HybridExpression::reduceBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, ExpressionReduction reduction) {
+    std::vector<Float64Buffer> views;
+    std::vector<const double*> data;
+    size_t n = collectInputs(inputs, views, data);
+    return _expression->reduce(data, n, toReduction(reduction));
+}
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "HybridExpressionSpec.hpp"
+#include "Expression.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a compiled element-wise expression
+class HybridExpression : public HybridExpressionSpec {
+public:
+    explicit HybridExpression(std::unique_ptr<const linalg::Expression> expression);
+
+    double getInputs() override;
+    double getNodes() override;
+
+    std::vector<double> evaluate(const std::vector<std::vector<double>>& inputs) override;
+    std::shared_ptr<ArrayBuffer> evaluateBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    double reduce(const std::vector<std::vector<double>>& inputs, ExpressionReduction reduction) override;
+    double reduceBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, ExpressionReduction reduction) override;
+
+private:
+    std::unique_ptr<const linalg::Expression> _expression;
+};
+
+} // namespace margelo::nitro::rnmath
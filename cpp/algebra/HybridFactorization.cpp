@@ -0,0 +1,69 @@
+#include "HybridFactorization.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+HybridFactorization::HybridFactorization(std::unique_ptr<const linalg::Factorization> factorization, FactorizationKind kind)
+    : HybridObject(TAG), _factorization(std::move(factorization)), _kind(kind) { }
+
+
+FactorizationKind HybridFactorization::getKind() {
+    return _kind;
+}
+
+double HybridFactorization::getRows() {
+    return static_cast<double>(_factorization->rows());
+}
+
+double HybridFactorization::getCols() {
+    return static_cast<double>(_factorization->cols());
+}
+
+std::vector<double> HybridFactorization::solve(const std::vector<double>& b) {
+    size_t m = _factorization->rows();
+    if (b.size() != m) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(b.size()) + " values, expected " + std::to_string(m));
+    }
+
+    std::vector<double> x(_factorization->cols());
+    _factorization->solve(ConstMatrixView(b.data(), m, 1), MatrixView(x.data(), x.size(), 1));
+    return x;
+}
+
+std::vector<std::vector<double>> HybridFactorization::solveMany(const std::vector<std::vector<double>>& B) {
+    Matrix mb = Matrix::fromRows(B);
+
+    Matrix x(_factorization->cols(), mb.cols());
+    _factorization->solve(mb, x);
+    return x.toRows();
+}
+
+std::shared_ptr<ArrayBuffer> HybridFactorization::solveBuffer(const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t m = _factorization->rows();
+    size_t n = _factorization->cols();
+    Float64Buffer vb = asFloat64(b, "b");
+    if (vb.size != m) {
+        throw std::runtime_error("Right-hand side has " + std::to_string(vb.size) + " values, expected " + std::to_string(m));
+    }
+
+    auto result = outputFloat64(out, n);
+    Float64Buffer vx = asFloat64(result, "out");
+    if (overlaps(vx, vb) && (vx.data != vb.data || m != n)) {
+        throw std::runtime_error("Output buffer must be the right-hand side itself or not overlap it");
+    }
+
+    _factorization->solve(ConstMatrixView(vb.data, m, 1), MatrixView(vx.data, n, 1));
+    return result;
+}
+
+double HybridFactorization::determinant() {
+    return _factorization->determinant();
+}
+
+size_t HybridFactorization::getExternalMemorySize() noexcept {
+    return _factorization->memorySize();
+}
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "HybridFactorizationSpec.hpp"
+#include "Decompositions.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a matrix factorization kept alive between solves
+class HybridFactorization : public HybridFactorizationSpec {
+public:
+    HybridFactorization(std::unique_ptr<const linalg::Factorization> factorization, FactorizationKind kind);
+
+    FactorizationKind getKind() override;
+    double getRows() override;
+    double getCols() override;
+
+    std::vector<double> solve(const std::vector<double>& b) override;
+    std::vector<std::vector<double>> solveMany(const std::vector<std::vector<double>>& B) override;
+    std::shared_ptr<ArrayBuffer> solveBuffer(const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    double determinant() override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    std::unique_ptr<const linalg::Factorization> _factorization;
+    FactorizationKind _kind;
+};
+
+} // namespace margelo::nitro::rnmath
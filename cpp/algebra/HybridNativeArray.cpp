@@ -0,0 +1,453 @@
+#include "HybridNativeArray.hpp"
+#include "LinearAlgebra.hpp"
+#include "Gemm.hpp"
+#include "../signal/FFT.hpp"
+#include "../signal/Convolution.hpp"
+#include "../statistics/Moments.hpp"
+#include "../utils/BufferUtils.hpp"
+#include "../utils/ElementwiseUtils.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace margelo::nitro::rnmath {
+
+// Element-wise loops hand each worker at least this many values
+static constexpr size_t ARRAY_GRAIN = 16384;
+// float32 values are widened to double in blocks of this size for the vmath kernels
+static constexpr size_t ARRAY_BLOCK = 256;
+
+static size_t elementSize(DType dtype) {
+    return dtype == DType::FLOAT32 ? sizeof(float) : sizeof(double);
+}
+
+// Calls `f` with a zero value of the array's element type
+template <typename F>
+static auto dispatch(DType dtype, F&& f) {
+    if (dtype == DType::FLOAT32) return f(float{});
+    return f(double{});
+}
+
+template <typename F>
+static void forBlocks(size_t n, F&& f) {
+    ThreadPool& pool = ThreadPool::shared();
+    pool.parallelFor(n, pool.grainFor(n, ARRAY_GRAIN), f);
+}
+
+// Arrays can outlive the Math object, so they keep their own plan caches
+template <typename T>
+static dsp::PlanCache<dsp::BasicRealFFTPlan<T>>& realPlans() {
+    static dsp::PlanCache<dsp::BasicRealFFTPlan<T>> plans;
+    return plans;
+}
+
+static dsp::ConvolutionMethod toConvolutionMethod(std::optional<ConvolutionMode> mode) {
+    switch (mode.value_or(ConvolutionMode::AUTO)) {
+        case ConvolutionMode::DIRECT: return dsp::ConvolutionMethod::Direct;
+        case ConvolutionMode::FFT: return dsp::ConvolutionMethod::FFT;
+        case ConvolutionMode::OVERLAPADD: return dsp::ConvolutionMethod::OverlapAdd;
+        default: return dsp::ConvolutionMethod::Auto;
+    }
+}
+
+// One-pass summary behind sum, mean, min, max and variance, the same kernel
+// as Math.describe
+static stats::Moments momentsOf(const HybridNativeArray& a) {
+    return dispatch(a.dtype(), [&](auto zero) {
+        using T = decltype(zero);
+        return stats::moments(a.data<T>(), a.size());
+    });
+}
+
+// Converts an array of either dtype to a double matrix, for the LU-based kernels
+static Matrix toMatrixOf(const HybridNativeArray& a) {
+    Matrix m(a.rows(), a.cols());
+    dispatch(a.dtype(), [&](auto zero) {
+        using T = decltype(zero);
+        std::copy(a.data<T>(), a.data<T>() + a.size(), m.data());
+    });
+    return m;
+}
+
+static std::shared_ptr<HybridNativeArray> fromMatrixOf(const Matrix& m, DType dtype) {
+    auto result = HybridNativeArray::allocate(m.rows(), m.cols(), dtype);
+    dispatch(dtype, [&](auto zero) {
+        using T = decltype(zero);
+        std::transform(m.data(), m.data() + m.size(), result->data<T>(), [](double v) { return static_cast<T>(v); });
+    });
+    return result;
+}
+
+template <typename Op>
+static std::shared_ptr<HybridNativeArray> zip(const HybridNativeArray& a, const std::shared_ptr<HybridNativeArraySpec>& other, const char* operation, Op op) {
+    HybridNativeArray& b = HybridNativeArray::unwrap(other, "other");
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw std::runtime_error(std::string("NativeArrays must have same shape for ") + operation);
+    }
+    if (a.dtype() != b.dtype()) {
+        throw std::runtime_error(std::string("NativeArrays must have same dtype for ") + operation);
+    }
+
+    auto result = HybridNativeArray::allocate(a.rows(), a.cols(), a.dtype());
+    dispatch(a.dtype(), [&](auto zero) {
+        using T = decltype(zero);
+        const T* x = a.data<T>();
+        const T* y = b.data<T>();
+        T* out = result->data<T>();
+        forBlocks(a.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) out[i] = op(x[i], y[i]);
+        });
+    });
+    return result;
+}
+
+// Applies a double kernel `f(in, out, n)`; float32 goes through double blocks
+template <typename F>
+static std::shared_ptr<HybridNativeArray> mapWith(const HybridNativeArray& a, F f) {
+    auto result = HybridNativeArray::allocate(a.rows(), a.cols(), a.dtype());
+    size_t n = a.size();
+    if (a.dtype() == DType::FLOAT64) {
+        f(a.data<double>(), result->data<double>(), n);
+        return result;
+    }
+
+    const float* in = a.data<float>();
+    float* out = result->data<float>();
+    forBlocks(n, [&](size_t begin, size_t end) {
+        double block[ARRAY_BLOCK];
+        for (size_t i = begin; i < end; i += ARRAY_BLOCK) {
+            size_t len = std::min(ARRAY_BLOCK, end - i);
+            std::copy(in + i, in + i + len, block);
+            f(block, block, len);
+            std::transform(block, block + len, out + i, [](double v) { return static_cast<float>(v); });
+        }
+    });
+    return result;
+}
+
+
+HybridNativeArray::HybridNativeArray(std::shared_ptr<ArrayBuffer> data, size_t rows, size_t cols, DType dtype)
+    : HybridObject(TAG), _data(std::move(data)), _rows(rows), _cols(cols), _dtype(dtype) { }
+
+std::shared_ptr<HybridNativeArray> HybridNativeArray::allocate(size_t rows, size_t cols, DType dtype) {
+    if (cols != 0 && rows > std::numeric_limits<size_t>::max() / cols / elementSize(dtype)) {
+        throw std::runtime_error("NativeArray is too large");
+    }
+    return std::make_shared<HybridNativeArray>(ArrayBuffer::allocate(rows * cols * elementSize(dtype)), rows, cols, dtype);
+}
+
+HybridNativeArray& HybridNativeArray::unwrap(const std::shared_ptr<HybridNativeArraySpec>& array, const char* name) {
+    auto native = std::dynamic_pointer_cast<HybridNativeArray>(array);
+    if (native == nullptr) {
+        throw std::runtime_error(std::string(name) + " is not a NativeArray");
+    }
+    return *native;
+}
+
+size_t HybridNativeArray::vectorLength(const char* operation) const {
+    if (_rows != 1 && _cols != 1) {
+        throw std::runtime_error(std::string(operation) + " requires a vector (one row or one column), got " + std::to_string(_rows) + " x " + std::to_string(_cols));
+    }
+    return size();
+}
+
+
+double HybridNativeArray::getRows() {
+    return static_cast<double>(_rows);
+}
+
+double HybridNativeArray::getCols() {
+    return static_cast<double>(_cols);
+}
+
+double HybridNativeArray::getSize() {
+    return static_cast<double>(size());
+}
+
+DType HybridNativeArray::getDtype() {
+    return _dtype;
+}
+
+std::shared_ptr<ArrayBuffer> HybridNativeArray::getBuffer() {
+    return _data;
+}
+
+std::vector<double> HybridNativeArray::toArray() {
+    return dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        return std::vector<double>(data<T>(), data<T>() + size());
+    });
+}
+
+std::vector<std::vector<double>> HybridNativeArray::toMatrix() {
+    std::vector<std::vector<double>> result(_rows);
+    dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        for (size_t i = 0; i < _rows; i++) {
+            const T* row = data<T>() + i * _cols;
+            result[i].assign(row, row + _cols);
+        }
+    });
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::clone() {
+    auto result = allocate(_rows, _cols, _dtype);
+    if (size() > 0) std::memcpy(result->_data->data(), _data->data(), size() * elementSize(_dtype));
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::astype(DType dtype) {
+    if (dtype == _dtype) return clone();
+
+    auto result = allocate(_rows, _cols, dtype);
+    if (dtype == DType::FLOAT32) {
+        std::transform(data<double>(), data<double>() + size(), result->data<float>(), [](double v) { return static_cast<float>(v); });
+    } else {
+        std::copy(data<float>(), data<float>() + size(), result->data<double>());
+    }
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::reshape(double rows, double cols) {
+    size_t r = toSize(rows, "rows");
+    size_t c = toSize(cols, "cols");
+    if ((c != 0 && r > size() / c) || r * c != size()) {
+        throw std::runtime_error("Cannot reshape " + std::to_string(_rows) + " x " + std::to_string(_cols) + " to " + std::to_string(r) + " x " + std::to_string(c));
+    }
+    auto view = std::make_shared<HybridNativeArray>(_data, r, c, _dtype);
+    view->_view = true;
+    return view;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::transpose() {
+    auto result = allocate(_cols, _rows, _dtype);
+    if (_rows == 1 || _cols == 1) {
+        if (size() > 0) std::memcpy(result->_data->data(), _data->data(), size() * elementSize(_dtype));
+        return result;
+    }
+
+    if (_dtype == DType::FLOAT64) {
+        linalg::transpose(ConstMatrixView(data<double>(), _rows, _cols), MatrixView(result->data<double>(), _cols, _rows));
+        return result;
+    }
+
+    // Tiles keep both the reads and the writes within a few cache lines
+    constexpr size_t tile = 32;
+    const float* in = data<float>();
+    float* out = result->data<float>();
+    for (size_t i0 = 0; i0 < _rows; i0 += tile) {
+        for (size_t j0 = 0; j0 < _cols; j0 += tile) {
+            size_t i1 = std::min(_rows, i0 + tile);
+            size_t j1 = std::min(_cols, j0 + tile);
+            for (size_t i = i0; i < i1; i++) {
+                for (size_t j = j0; j < j1; j++) out[j * _rows + i] = in[i * _cols + j];
+            }
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::add(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    return zip(*this, other, "addition", [](auto x, auto y) { return x + y; });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::sub(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    return zip(*this, other, "subtraction", [](auto x, auto y) { return x - y; });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::mul(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    return zip(*this, other, "multiplication", [](auto x, auto y) { return x * y; });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::div(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    return zip(*this, other, "division", [](auto x, auto y) { return x / y; });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::scale(double scalar) {
+    auto result = allocate(_rows, _cols, _dtype);
+    dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        const T* x = data<T>();
+        T* out = result->data<T>();
+        T s = static_cast<T>(scalar);
+        forBlocks(size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) out[i] = x[i] * s;
+        });
+    });
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::map(ElementwiseFunction fn) {
+    vmath::Function function = toVmath(fn);
+    return mapWith(*this, [function](const double* in, double* out, size_t n) { vmath::map(function, in, out, n); });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::pow(double exponent) {
+    return mapWith(*this, [exponent](const double* in, double* out, size_t n) { vmath::power(in, exponent, out, n); });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::matmul(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    HybridNativeArray& b = unwrap(other, "other");
+    if (_cols != b._rows) {
+        throw std::runtime_error("Matrix dimensions incompatible for multiplication");
+    }
+    if (_dtype != b._dtype) {
+        throw std::runtime_error("NativeArrays must have same dtype for multiplication");
+    }
+
+    auto result = allocate(_rows, b._cols, _dtype);
+    dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        linalg::gemm(BasicMatrixView<const T>(data<T>(), _rows, _cols),
+                     BasicMatrixView<const T>(b.data<T>(), b._rows, b._cols),
+                     BasicMatrixView<T>(result->data<T>(), _rows, b._cols));
+    });
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::solve(const std::shared_ptr<HybridNativeArraySpec>& b) {
+    HybridNativeArray& rhs = unwrap(b, "b");
+    if (_rows != _cols) {
+        throw std::runtime_error("Matrix must be square to solve a linear system");
+    }
+    if (rhs._rows != _rows) {
+        throw std::runtime_error("Right-hand side must have one row per matrix row");
+    }
+    return fromMatrixOf(linalg::solve(toMatrixOf(*this), toMatrixOf(rhs)), _dtype);
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::inverse() {
+    if (_rows != _cols) {
+        throw std::runtime_error("Matrix must be square for inverse calculation");
+    }
+    return fromMatrixOf(linalg::inverse(toMatrixOf(*this)), _dtype);
+}
+
+double HybridNativeArray::dot(const std::shared_ptr<HybridNativeArraySpec>& other) {
+    HybridNativeArray& b = unwrap(other, "other");
+    if (size() != b.size()) {
+        throw std::runtime_error("NativeArrays must have same size for dot product");
+    }
+    if (_dtype != b._dtype) {
+        throw std::runtime_error("NativeArrays must have same dtype for dot product");
+    }
+    return dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        const T* x = data<T>();
+        const T* y = b.data<T>();
+        double result = 0.0;
+        for (size_t i = 0; i < size(); i++) result += static_cast<double>(x[i]) * y[i];
+        return result;
+    });
+}
+
+double HybridNativeArray::norm() {
+    return dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        const T* x = data<T>();
+        double sum_sq = 0.0;
+        for (size_t i = 0; i < size(); i++) sum_sq += static_cast<double>(x[i]) * x[i];
+        return std::sqrt(sum_sq);
+    });
+}
+
+double HybridNativeArray::sum() {
+    stats::Moments m = momentsOf(*this);
+    return m.mean * static_cast<double>(m.count);
+}
+
+double HybridNativeArray::mean() {
+    return momentsOf(*this).mean;
+}
+
+double HybridNativeArray::min() {
+    if (size() == 0) throw std::runtime_error("Cannot find min of empty NativeArray");
+    stats::Moments m = momentsOf(*this);
+    // min and max skip NaN, so an all-NaN array leaves them crossed
+    return m.min > m.max ? std::numeric_limits<double>::quiet_NaN() : m.min;
+}
+
+double HybridNativeArray::max() {
+    if (size() == 0) throw std::runtime_error("Cannot find max of empty NativeArray");
+    stats::Moments m = momentsOf(*this);
+    return m.min > m.max ? std::numeric_limits<double>::quiet_NaN() : m.max;
+}
+
+double HybridNativeArray::variance(std::optional<bool> population) {
+    return momentsOf(*this).variance(population.value_or(false)); // Default to sample variance
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::rfft() {
+    size_t n = vectorLength("rfft");
+    return dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        auto plan = realPlans<T>().get(n, dsp::FFTDirection::Forward);
+        size_t bins = plan->bins();
+        std::vector<T> re(bins), im(bins);
+        plan->forward(data<T>(), re.data(), im.data());
+
+        auto result = allocate(bins, 2, _dtype);
+        T* out = result->data<T>();
+        for (size_t k = 0; k < bins; k++) {
+            out[2 * k] = re[k];
+            out[2 * k + 1] = im[k];
+        }
+        return result;
+    });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::irfft(std::optional<double> size) {
+    if (_cols != 2) {
+        throw std::runtime_error("irfft expects a bins x 2 spectrum of real and imaginary parts");
+    }
+    if (_rows == 0) {
+        throw std::runtime_error("Half spectrum must not be empty");
+    }
+    size_t N = size.has_value() ? toSize(size.value(), "size") : 2 * (_rows - 1);
+    if (N == 0 || N / 2 + 1 != _rows) {
+        throw std::runtime_error("Half spectrum of " + std::to_string(_rows) + " bins does not match output size " + std::to_string(N));
+    }
+
+    return dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        auto plan = realPlans<T>().get(N, dsp::FFTDirection::Inverse);
+        const T* in = data<T>();
+        std::vector<T> re(_rows), im(_rows);
+        for (size_t k = 0; k < _rows; k++) {
+            re[k] = in[2 * k];
+            im[k] = in[2 * k + 1];
+        }
+
+        auto result = allocate(N, 1, _dtype);
+        plan->inverse(re.data(), im.data(), result->data<T>());
+        return result;
+    });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridNativeArray::convolve(const std::shared_ptr<HybridNativeArraySpec>& kernel, std::optional<ConvolutionMode> mode) {
+    HybridNativeArray& h = unwrap(kernel, "kernel");
+    size_t n = vectorLength("convolve");
+    size_t m = h.vectorLength("convolve");
+    if (_dtype != h._dtype) {
+        throw std::runtime_error("NativeArrays must have same dtype for convolution");
+    }
+    if (n == 0 || m == 0) return allocate(0, 1, _dtype);
+
+    auto result = allocate(n + m - 1, 1, _dtype);
+    dispatch(_dtype, [&](auto zero) {
+        using T = decltype(zero);
+        dsp::convolve(data<T>(), n, h.data<T>(), m, result->data<T>(), toConvolutionMethod(mode), realPlans<T>());
+    });
+    return result;
+}
+
+size_t HybridNativeArray::getExternalMemorySize() noexcept {
+    return _view ? 0 : _data->size();
+}
+
+} // namespace margelo::nitro::rnmath
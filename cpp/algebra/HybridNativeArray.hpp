@@ -0,0 +1,82 @@
+#pragma once
+
+#include "HybridNativeArraySpec.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a row-major array kept in native memory between calls.
+// Storage is an ArrayBuffer owned by native code, so the `buffer` property
+// can hand it to the `*Buffer` methods without copying. Reshaped arrays share
+// storage with the array they came from, and leave reporting its size to
+// that array so the GC does not count the same bytes twice.
+class HybridNativeArray : public HybridNativeArraySpec {
+public:
+    HybridNativeArray(std::shared_ptr<ArrayBuffer> data, size_t rows, size_t cols, DType dtype);
+
+    // Uninitialized storage for rows x cols values
+    static std::shared_ptr<HybridNativeArray> allocate(size_t rows, size_t cols, DType dtype);
+    // Arguments typed as NativeArray in the spec may still be foreign HybridObjects
+    static HybridNativeArray& unwrap(const std::shared_ptr<HybridNativeArraySpec>& array, const char* name);
+
+    size_t rows() const { return _rows; }
+    size_t cols() const { return _cols; }
+    size_t size() const { return _rows * _cols; }
+    DType dtype() const { return _dtype; }
+    template <typename T>
+    T* data() const { return reinterpret_cast<T*>(_data->data()); }
+
+    double getRows() override;
+    double getCols() override;
+    double getSize() override;
+    DType getDtype() override;
+    std::shared_ptr<ArrayBuffer> getBuffer() override;
+
+    std::vector<double> toArray() override;
+    std::vector<std::vector<double>> toMatrix() override;
+    std::shared_ptr<HybridNativeArraySpec> clone() override;
+    std::shared_ptr<HybridNativeArraySpec> astype(DType dtype) override;
+    std::shared_ptr<HybridNativeArraySpec> reshape(double rows, double cols) override;
+    std::shared_ptr<HybridNativeArraySpec> transpose() override;
+
+    std::shared_ptr<HybridNativeArraySpec> add(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    std::shared_ptr<HybridNativeArraySpec> sub(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    std::shared_ptr<HybridNativeArraySpec> mul(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    std::shared_ptr<HybridNativeArraySpec> div(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    std::shared_ptr<HybridNativeArraySpec> scale(double scalar) override;
+    std::shared_ptr<HybridNativeArraySpec> map(ElementwiseFunction fn) override;
+    std::shared_ptr<HybridNativeArraySpec> pow(double exponent) override;
+
+    std::shared_ptr<HybridNativeArraySpec> matmul(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    std::shared_ptr<HybridNativeArraySpec> solve(const std::shared_ptr<HybridNativeArraySpec>& b) override;
+    std::shared_ptr<HybridNativeArraySpec> inverse() override;
+
+    double dot(const std::shared_ptr<HybridNativeArraySpec>& other) override;
+    double norm() override;
+    double sum() override;
+    double mean() override;
+    double min() override;
+    double max() override;
+    double variance(std::optional<bool> population) override;
+
+    std::shared_ptr<HybridNativeArraySpec> rfft() override;
+    std::shared_ptr<HybridNativeArraySpec> irfft(std::optional<double> size) override;
+    std::shared_ptr<HybridNativeArraySpec> convolve(const std::shared_ptr<HybridNativeArraySpec>& kernel, std::optional<ConvolutionMode> mode) override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    // Length of a row or column vector; throws for other shapes
+    size_t vectorLength(const char* operation) const;
+
+    std::shared_ptr<ArrayBuffer> _data;
+    size_t _rows;
+    size_t _cols;
+    DType _dtype;
+    // Set on reshaped arrays, which do not own _data
+    bool _view = false;
+};
+
+} // namespace margelo::nitro::rnmath
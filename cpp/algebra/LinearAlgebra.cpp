@@ -1,107 +1,129 @@
-#include "../HybridMath.hpp"
+#include "LinearAlgebra.hpp"
+#include "Gemm.hpp"
+#include "Decompositions.hpp"
+#include "../utils/ThreadPool.hpp"
 #include <stdexcept>
-#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <functional>
 
-namespace margelo::nitro::rnmath {
+namespace margelo::nitro::rnmath::linalg {
 
+// Tile edge used by transpose so both source and destination stay in L1
+static constexpr size_t TRANSPOSE_TILE = 32;
+// Element count below which memory-bound kernels stay on the calling thread
+static constexpr size_t PARALLEL_MIN_ELEMENTS = size_t(1) << 16;
 
-std::vector<std::vector<double>> HybridMath::matrixMultiply(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
-    validateMatrix(a);
-    validateMatrix(b);
-    
-    size_t a_rows = a.size();
-    size_t a_cols = a[0].size();
-    size_t b_rows = b.size();
-    size_t b_cols = b[0].size();
-    
-    if (a_cols != b_rows) {
-        throw std::runtime_error("Matrix dimensions incompatible for multiplication");
-    }
-    
-    std::vector<std::vector<double>> result(a_rows, std::vector<double>(b_cols, 0.0));
-    
-    for (size_t i = 0; i < a_rows; i++) {
-        for (size_t j = 0; j < b_cols; j++) {
-            for (size_t k = 0; k < a_cols; k++) {
-                result[i][j] += a[i][k] * b[k][j];
+// Splits `rows` rows of `cols` elements each across the shared pool
+static void parallelRows(size_t rows, size_t cols, const std::function<void(size_t, size_t)>& fn) {
+    ThreadPool& pool = ThreadPool::shared();
+    size_t min_rows = std::max<size_t>(1, PARALLEL_MIN_ELEMENTS / std::max<size_t>(cols, 1));
+    pool.parallelFor(rows, pool.grainFor(rows, min_rows), fn);
+}
+
+
+void transpose(ConstMatrixView a, MatrixView out) {
+    size_t tile_rows = (a.rows + TRANSPOSE_TILE - 1) / TRANSPOSE_TILE;
+    parallelRows(tile_rows, TRANSPOSE_TILE * a.cols, [&](size_t t0, size_t t1) {
+        for (size_t i0 = t0 * TRANSPOSE_TILE; i0 < std::min(t1 * TRANSPOSE_TILE, a.rows); i0 += TRANSPOSE_TILE) {
+            size_t i1 = std::min(i0 + TRANSPOSE_TILE, a.rows);
+            for (size_t j0 = 0; j0 < a.cols; j0 += TRANSPOSE_TILE) {
+                size_t j1 = std::min(j0 + TRANSPOSE_TILE, a.cols);
+                for (size_t i = i0; i < i1; i++) {
+                    const double* src = a.row(i);
+                    for (size_t j = j0; j < j1; j++) {
+                        out(j, i) = src[j];
+                    }
+                }
             }
         }
-    }
-    return result;
+    });
+}
+
+void add(ConstMatrixView a, ConstMatrixView b, MatrixView out) {
+    parallelRows(a.rows, a.cols, [&](size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; i++) {
+            const double* ra = a.row(i);
+            const double* rb = b.row(i);
+            double* ro = out.row(i);
+            for (size_t j = 0; j < a.cols; j++) {
+                ro[j] = ra[j] + rb[j];
+            }
+        }
+    });
+}
+
+void subtract(ConstMatrixView a, ConstMatrixView b, MatrixView out) {
+    parallelRows(a.rows, a.cols, [&](size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; i++) {
+            const double* ra = a.row(i);
+            const double* rb = b.row(i);
+            double* ro = out.row(i);
+            for (size_t j = 0; j < a.cols; j++) {
+                ro[j] = ra[j] - rb[j];
+            }
+        }
+    });
 }
 
-std::vector<std::vector<double>> HybridMath::matrixScalarMultiply(const std::vector<std::vector<double>>& matrix, double scalar) {
-    validateMatrix(matrix);
-    
-    size_t rows = matrix.size();
-    size_t cols = matrix[0].size();
-    std::vector<std::vector<double>> result(rows, std::vector<double>(cols));
-    
-    for (size_t i = 0; i < rows; i++) {
-        for (size_t j = 0; j < cols; j++) {
-            result[i][j] = matrix[i][j] * scalar;
+void scale(ConstMatrixView a, double scalar, MatrixView out) {
+    parallelRows(a.rows, a.cols, [&](size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; i++) {
+            const double* ra = a.row(i);
+            double* ro = out.row(i);
+            for (size_t j = 0; j < a.cols; j++) {
+                ro[j] = ra[j] * scalar;
+            }
         }
+    });
+}
+
+void multiply(ConstMatrixView a, ConstMatrixView b, MatrixView out) {
+    gemm(a, b, out);
+}
+
+double trace(ConstMatrixView a) {
+    double result = 0.0;
+    for (size_t i = 0; i < a.rows; i++) {
+        result += a(i, i);
     }
     return result;
 }
 
-double HybridMath::matrixDeterminant(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
-        throw std::runtime_error("Matrix must be square for determinant calculation");
-    }
-    
-    size_t n = matrix.size();
-    
+double determinant(ConstMatrixView a) {
+    size_t n = a.rows;
 
-    if (n == 1) {
-        return matrix[0][0];
+    // Closed forms are exact for small integer matrices
+    if (n == 0) {
+        return 1.0;
+    } else if (n == 1) {
+        return a(0, 0);
     } else if (n == 2) {
-        return matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0];
+        return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
     } else if (n == 3) {
-        return matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1]) -
-               matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0]) +
-               matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
-    } else {
-        throw std::runtime_error("Determinant only implemented for 1x1, 2x2, 3x3 matrices");
+        return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1)) -
+               a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0)) +
+               a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
     }
+    return LU(a).determinant();
 }
 
-std::vector<std::vector<double>> HybridMath::matrixInverse(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
-        throw std::runtime_error("Matrix must be square for inverse calculation");
-    }
-    
-    size_t n = matrix.size();
-    double det = matrixDeterminant(matrix);
-    
-    if (det == 0) {
+Matrix inverse(ConstMatrixView a) {
+    LU lu(a);
+    if (lu.isSingular()) {
         throw std::runtime_error("Matrix is singular, cannot compute inverse");
     }
-    
-
-    if (n == 2) {
-        std::vector<std::vector<double>> inverse(2, std::vector<double>(2));
-        inverse[0][0] = matrix[1][1] / det;
-        inverse[0][1] = -matrix[0][1] / det;
-        inverse[1][0] = -matrix[1][0] / det;
-        inverse[1][1] = matrix[0][0] / det;
-        return inverse;
-    } else {
-        throw std::runtime_error("Matrix inverse only implemented for 2x2 matrices");
-    }
+    return lu.inverse();
 }
 
-double HybridMath::matrixTrace(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
-        throw std::runtime_error("Matrix must be square for trace calculation");
-    }
-    
-    double trace = 0.0;
-    for (size_t i = 0; i < matrix.size(); i++) {
-        trace += matrix[i][i];
+Matrix solve(ConstMatrixView a, ConstMatrixView b) {
+    LU lu(a);
+    if (lu.isSingular()) {
+        throw std::runtime_error("Matrix is singular, cannot solve");
     }
-    return trace;
+    Matrix x = Matrix::copyOf(b);
+    lu.solve(x);
+    return x;
 }
 
-} // namespace margelo::nitro::rnmath
+} // namespace margelo::nitro::rnmath::linalg
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+namespace margelo::nitro::rnmath::linalg {
+
+// Dense kernels over row-major views. Large inputs are split by row or tile
+// across the shared ThreadPool.
+// Output views must already have the right shape and must not alias the inputs
+// unless stated otherwise. Dimension checks are the caller's responsibility.
+
+void transpose(ConstMatrixView a, MatrixView out);
+
+// Element-wise kernels, `out` may alias `a` or `b`
+void add(ConstMatrixView a, ConstMatrixView b, MatrixView out);
+void subtract(ConstMatrixView a, ConstMatrixView b, MatrixView out);
+void scale(ConstMatrixView a, double scalar, MatrixView out);
+
+// out = a * b, see gemm()
+void multiply(ConstMatrixView a, ConstMatrixView b, MatrixView out);
+
+double trace(ConstMatrixView a);
+// Determinant, inverse and solve go through an LU factorization, see LU
+double determinant(ConstMatrixView a);
+Matrix inverse(ConstMatrixView a);
+// X such that a * X = b, without forming the inverse
+Matrix solve(ConstMatrixView a, ConstMatrixView b);
+
+} // namespace margelo::nitro::rnmath::linalg
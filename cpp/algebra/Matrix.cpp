@@ -0,0 +1,52 @@
+#include "Matrix.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+namespace margelo::nitro::rnmath {
+
+
+Matrix Matrix::identity(size_t n) {
+    Matrix result(n, n, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        result(i, i) = 1.0;
+    }
+    return result;
+}
+
+Matrix Matrix::copyOf(ConstMatrixView view) {
+    Matrix result(view.rows, view.cols);
+    for (size_t i = 0; i < view.rows; i++) {
+        std::copy_n(view.row(i), view.cols, result.row(i));
+    }
+    return result;
+}
+
+Matrix Matrix::fromRows(const std::vector<std::vector<double>>& rows) {
+    if (rows.empty()) throw std::runtime_error("Matrix is empty");
+
+    size_t cols = rows[0].size();
+    Matrix result(rows.size(), cols);
+    for (size_t i = 0; i < rows.size(); i++) {
+        if (rows[i].size() != cols) {
+            throw std::runtime_error("Matrix has inconsistent row sizes");
+        }
+        std::copy(rows[i].begin(), rows[i].end(), result.row(i));
+    }
+    return result;
+}
+
+std::vector<std::vector<double>> Matrix::toRows() const {
+    return rnmath::toRows(view());
+}
+
+std::vector<std::vector<double>> toRows(ConstMatrixView view) {
+    std::vector<std::vector<double>> result;
+    result.reserve(view.rows);
+    for (size_t i = 0; i < view.rows; i++) {
+        const double* row = view.row(i);
+        result.emplace_back(row, row + view.cols);
+    }
+    return result;
+}
+
+} // namespace margelo::nitro::rnmath
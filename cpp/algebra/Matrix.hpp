@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+namespace margelo::nitro::rnmath {
+
+// Non-owning, row-major view over a block of memory.
+// `stride` is the distance (in elements) between the starts of two consecutive
+// rows, so a view can describe a sub-block of a larger matrix without copying.
+template <typename T>
+struct BasicMatrixView {
+    T* data = nullptr;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t stride = 0;
+
+    BasicMatrixView() = default;
+    BasicMatrixView(T* data, size_t rows, size_t cols, size_t stride)
+        : data(data), rows(rows), cols(cols), stride(stride) { }
+    BasicMatrixView(T* data, size_t rows, size_t cols)
+        : data(data), rows(rows), cols(cols), stride(cols) { }
+
+    // Allow a mutable view to be passed where a const view is expected
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    BasicMatrixView(const BasicMatrixView<U>& other)
+        : data(other.data), rows(other.rows), cols(other.cols), stride(other.stride) { }
+
+    T& operator()(size_t i, size_t j) const { return data[i * stride + j]; }
+    T* row(size_t i) const { return data + i * stride; }
+
+    bool empty() const { return rows == 0 || cols == 0; }
+    bool isSquare() const { return rows == cols; }
+    bool isContiguous() const { return stride == cols || rows <= 1; }
+
+    BasicMatrixView block(size_t row0, size_t col0, size_t numRows, size_t numCols) const {
+        return BasicMatrixView(data + row0 * stride + col0, numRows, numCols, stride);
+    }
+};
+
+using MatrixView = BasicMatrixView<double>;
+using ConstMatrixView = BasicMatrixView<const double>;
+using FloatMatrixView = BasicMatrixView<float>;
+using ConstFloatMatrixView = BasicMatrixView<const float>;
+
+// Dense, owning, row-major matrix backed by a single contiguous allocation.
+class Matrix {
+public:
+    Matrix() = default;
+    Matrix(size_t rows, size_t cols, double value = 0.0)
+        : _rows(rows), _cols(cols), _data(rows * cols, value) { }
+
+    static Matrix identity(size_t n);
+    static Matrix copyOf(ConstMatrixView view);
+
+    // Conversion from/to the nested representation used by the JS bridge.
+    // `fromRows` validates that the input is non-empty and rectangular.
+    static Matrix fromRows(const std::vector<std::vector<double>>& rows);
+    std::vector<std::vector<double>> toRows() const;
+
+    size_t rows() const { return _rows; }
+    size_t cols() const { return _cols; }
+    size_t size() const { return _data.size(); }
+    bool isSquare() const { return _rows == _cols; }
+
+    double* data() { return _data.data(); }
+    const double* data() const { return _data.data(); }
+    double* row(size_t i) { return _data.data() + i * _cols; }
+    const double* row(size_t i) const { return _data.data() + i * _cols; }
+
+    double& operator()(size_t i, size_t j) { return _data[i * _cols + j]; }
+    double operator()(size_t i, size_t j) const { return _data[i * _cols + j]; }
+
+    MatrixView view() { return MatrixView(_data.data(), _rows, _cols); }
+    ConstMatrixView view() const { return ConstMatrixView(_data.data(), _rows, _cols); }
+    operator MatrixView() { return view(); }
+    operator ConstMatrixView() const { return view(); }
+
+private:
+    size_t _rows = 0;
+    size_t _cols = 0;
+    std::vector<double> _data;
+};
+
+std::vector<std::vector<double>> toRows(ConstMatrixView view);
+
+} // namespace margelo::nitro::rnmath
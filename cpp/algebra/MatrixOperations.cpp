@@ -1,7 +1,15 @@
 #include "HybridMath.hpp"
+#include "LinearAlgebra.hpp"
+#include "Gemm.hpp"
+#include "Decompositions.hpp"
+#include "HybridFactorization.hpp"
+#include "HybridNativeArray.hpp"
+#include "../utils/BufferUtils.hpp"
 #include <stdexcept>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <cstring>
 
 namespace margelo::nitro::rnmath {
 
@@ -13,179 +21,263 @@ std::vector<std::vector<double>> HybridMath::matrixCreate(const std::vector<std:
 std::vector<std::vector<double>> HybridMath::matrixIdentity(double size) {
     int n = static_cast<int>(size);
     if (n <= 0) throw std::runtime_error("Matrix size must be positive");
-    
-    std::vector<std::vector<double>> result(n, std::vector<double>(n, 0.0));
-    for (int i = 0; i < n; i++) {
-        result[i][i] = 1.0;
-    }
-    return result;
+    return Matrix::identity(n).toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixZeros(double rows, double cols) {
     int r = static_cast<int>(rows);
     int c = static_cast<int>(cols);
     if (r <= 0 || c <= 0) throw std::runtime_error("Matrix dimensions must be positive");
-    return std::vector<std::vector<double>>(r, std::vector<double>(c, 0.0));
+    return Matrix(r, c, 0.0).toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixOnes(double rows, double cols) {
     int r = static_cast<int>(rows);
     int c = static_cast<int>(cols);
     if (r <= 0 || c <= 0) throw std::runtime_error("Matrix dimensions must be positive");
-    return std::vector<std::vector<double>>(r, std::vector<double>(c, 1.0));
+    return Matrix(r, c, 1.0).toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixTranspose(const std::vector<std::vector<double>>& matrix) {
-    validateMatrix(matrix);
-    
-    size_t rows = matrix.size();
-    size_t cols = matrix[0].size();
-    
-    std::vector<std::vector<double>> result(cols, std::vector<double>(rows));
-    for (size_t i = 0; i < rows; i++) {
-        for (size_t j = 0; j < cols; j++) {
-            result[j][i] = matrix[i][j];
-        }
-    }
-    return result;
+    Matrix m = Matrix::fromRows(matrix);
+
+    Matrix result(m.cols(), m.rows());
+    linalg::transpose(m, result);
+    return result.toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixAdd(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
-    validateMatrix(a);
-    validateMatrix(b);
-    
-    if (a.size() != b.size() || a[0].size() != b[0].size()) {
+    Matrix ma = Matrix::fromRows(a);
+    Matrix mb = Matrix::fromRows(b);
+
+    if (ma.rows() != mb.rows() || ma.cols() != mb.cols()) {
         throw std::runtime_error("Matrix dimensions must match for addition");
     }
-    
-    size_t rows = a.size();
-    size_t cols = a[0].size();
-    std::vector<std::vector<double>> result(rows, std::vector<double>(cols));
-    
-    for (size_t i = 0; i < rows; i++) {
-        for (size_t j = 0; j < cols; j++) {
-            result[i][j] = a[i][j] + b[i][j];
-        }
-    }
-    return result;
+
+    linalg::add(ma, mb, ma);
+    return ma.toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixSubtract(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
-    validateMatrix(a);
-    validateMatrix(b);
-    
-    if (a.size() != b.size() || a[0].size() != b[0].size()) {
+    Matrix ma = Matrix::fromRows(a);
+    Matrix mb = Matrix::fromRows(b);
+
+    if (ma.rows() != mb.rows() || ma.cols() != mb.cols()) {
         throw std::runtime_error("Matrix dimensions must match for subtraction");
     }
-    
-    size_t rows = a.size();
-    size_t cols = a[0].size();
-    std::vector<std::vector<double>> result(rows, std::vector<double>(cols));
-    
-    for (size_t i = 0; i < rows; i++) {
-        for (size_t j = 0; j < cols; j++) {
-            result[i][j] = a[i][j] - b[i][j];
-        }
-    }
-    return result;
+
+    linalg::subtract(ma, mb, ma);
+    return ma.toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixMultiply(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
-    validateMatrix(a);
-    validateMatrix(b);
-    
-    size_t a_rows = a.size();
-    size_t a_cols = a[0].size();
-    size_t b_rows = b.size();
-    size_t b_cols = b[0].size();
-    
-    if (a_cols != b_rows) {
+    Matrix ma = Matrix::fromRows(a);
+    Matrix mb = Matrix::fromRows(b);
+
+    if (ma.cols() != mb.rows()) {
         throw std::runtime_error("Matrix dimensions incompatible for multiplication");
     }
-    
-    std::vector<std::vector<double>> result(a_rows, std::vector<double>(b_cols, 0.0));
-    
-    for (size_t i = 0; i < a_rows; i++) {
-        for (size_t j = 0; j < b_cols; j++) {
-            for (size_t k = 0; k < a_cols; k++) {
-                result[i][j] += a[i][k] * b[k][j];
-            }
-        }
-    }
-    return result;
+
+    Matrix result(ma.rows(), mb.cols());
+    linalg::multiply(ma, mb, result);
+    return result.toRows();
 }
 
 std::vector<std::vector<double>> HybridMath::matrixScalarMultiply(const std::vector<std::vector<double>>& matrix, double scalar) {
-    validateMatrix(matrix);
-    
-    size_t rows = matrix.size();
-    size_t cols = matrix[0].size();
-    std::vector<std::vector<double>> result(rows, std::vector<double>(cols));
-    
-    for (size_t i = 0; i < rows; i++) {
-        for (size_t j = 0; j < cols; j++) {
-            result[i][j] = matrix[i][j] * scalar;
-        }
-    }
-    return result;
+    Matrix m = Matrix::fromRows(matrix);
+
+    linalg::scale(m, scalar, m);
+    return m.toRows();
 }
 
 double HybridMath::matrixDeterminant(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
+    Matrix m = Matrix::fromRows(matrix);
+    if (!m.isSquare()) {
         throw std::runtime_error("Matrix must be square for determinant calculation");
     }
-    
-    size_t n = matrix.size();
-    
-    // Simple implementation for 1x1, 2x2, 3x3 matrices
-    if (n == 1) {
-        return matrix[0][0];
-    } else if (n == 2) {
-        return matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0];
-    } else if (n == 3) {
-        return matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1]) -
-               matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0]) +
-               matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
-    } else {
-        throw std::runtime_error("Determinant only implemented for 1x1, 2x2, 3x3 matrices");
-    }
+
+    return linalg::determinant(m);
 }
 
 std::vector<std::vector<double>> HybridMath::matrixInverse(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
+    Matrix m = Matrix::fromRows(matrix);
+    if (!m.isSquare()) {
         throw std::runtime_error("Matrix must be square for inverse calculation");
     }
-    
-    size_t n = matrix.size();
-    double det = matrixDeterminant(matrix);
-    
-    if (det == 0) {
-        throw std::runtime_error("Matrix is singular, cannot compute inverse");
-    }
-    
-
-    if (n == 2) {
-        std::vector<std::vector<double>> inverse(2, std::vector<double>(2));
-        inverse[0][0] = matrix[1][1] / det;
-        inverse[0][1] = -matrix[0][1] / det;
-        inverse[1][0] = -matrix[1][0] / det;
-        inverse[1][1] = matrix[0][0] / det;
-        return inverse;
-    } else {
-        throw std::runtime_error("Matrix inverse only implemented for 2x2 matrices");
-    }
+
+    return linalg::inverse(m).toRows();
 }
 
 double HybridMath::matrixTrace(const std::vector<std::vector<double>>& matrix) {
-    if (!isSquareMatrix(matrix)) {
+    Matrix m = Matrix::fromRows(matrix);
+    if (!m.isSquare()) {
         throw std::runtime_error("Matrix must be square for trace calculation");
     }
-    
-    double trace = 0.0;
-    for (size_t i = 0; i < matrix.size(); i++) {
-        trace += matrix[i][i];
+
+    return linalg::trace(m);
+}
+
+std::vector<double> HybridMath::matrixSolve(const std::vector<std::vector<double>>& A, const std::vector<double>& b) {
+    Matrix m = Matrix::fromRows(A);
+    if (!m.isSquare()) {
+        throw std::runtime_error("Matrix must be square to solve a linear system");
     }
-    return trace;
+    if (b.size() != m.rows()) {
+        throw std::runtime_error("Right-hand side must have one value per matrix row");
+    }
+
+    Matrix x = linalg::solve(m, ConstMatrixView(b.data(), b.size(), 1));
+    return std::vector<double>(x.data(), x.data() + x.size());
+}
+
+std::shared_ptr<HybridFactorizationSpec> HybridMath::factorize(const std::vector<std::vector<double>>& matrix, std::optional<FactorizationKind> kind) {
+    Matrix m = Matrix::fromRows(matrix);
+
+    FactorizationKind k = kind.value_or(FactorizationKind::LU);
+    std::unique_ptr<const linalg::Factorization> factorization;
+    switch (k) {
+        case FactorizationKind::CHOLESKY:
+            factorization = std::make_unique<linalg::Cholesky>(m);
+            break;
+        case FactorizationKind::QR:
+            factorization = std::make_unique<linalg::QR>(m);
+            break;
+        default:
+            factorization = std::make_unique<linalg::LU>(m);
+            break;
+    }
+    return std::make_shared<HybridFactorization>(std::move(factorization), k);
+}
+
+// === NATIVE ARRAYS ===
+
+// Copies `values` (rows x cols doubles) into a new array of the given dtype
+template <typename T>
+static void fillFrom(HybridNativeArray& array, const double* values) {
+    std::transform(values, values + array.size(), array.data<T>(), [](double v) { return static_cast<T>(v); });
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridMath::createNativeArray(const std::shared_ptr<ArrayBuffer>& data, double rows, double cols, std::optional<DType> dtype) {
+    size_t r = toSize(rows, "rows");
+    size_t c = toSize(cols, "cols");
+    DType type = dtype.value_or(DType::FLOAT64);
+    auto result = HybridNativeArray::allocate(r, c, type);
+
+    // JS-owned memory is copied once, so later calls never touch it
+    auto copyFrom = [&](auto zero) {
+        using T = decltype(zero);
+        TypedBuffer<T> values = asTyped<T>(data, "data");
+        if (values.size != result->size()) {
+            throw std::runtime_error("Buffer size does not match the given matrix dimensions");
+        }
+        std::copy(values.begin(), values.end(), result->data<T>());
+    };
+    if (type == DType::FLOAT32) copyFrom(float{});
+    else copyFrom(double{});
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridMath::nativeArrayFromVector(const std::vector<double>& vector, std::optional<DType> dtype) {
+    DType type = dtype.value_or(DType::FLOAT64);
+    auto result = HybridNativeArray::allocate(vector.size(), 1, type);
+    if (type == DType::FLOAT32) fillFrom<float>(*result, vector.data());
+    else fillFrom<double>(*result, vector.data());
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridMath::nativeArrayFromMatrix(const std::vector<std::vector<double>>& matrix, std::optional<DType> dtype) {
+    Matrix m = Matrix::fromRows(matrix);
+
+    DType type = dtype.value_or(DType::FLOAT64);
+    auto result = HybridNativeArray::allocate(m.rows(), m.cols(), type);
+    if (type == DType::FLOAT32) fillFrom<float>(*result, m.data());
+    else fillFrom<double>(*result, m.data());
+    return result;
+}
+
+std::shared_ptr<HybridNativeArraySpec> HybridMath::nativeArrayZeros(double rows, double cols, std::optional<DType> dtype) {
+    auto result = HybridNativeArray::allocate(toSize(rows, "rows"), toSize(cols, "cols"), dtype.value_or(DType::FLOAT64));
+    std::shared_ptr<ArrayBuffer> storage = result->getBuffer();
+    if (storage->size() > 0) std::memset(storage->data(), 0, storage->size());
+    return result;
+}
+
+// Row-major product of two packed buffers, shared by the float64 and float32 entry points
+template <typename T>
+static std::shared_ptr<ArrayBuffer> multiplyBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t m = toSize(rows, "rows");
+    size_t k = toSize(inner, "inner");
+    size_t n = toSize(cols, "cols");
+    size_t sizeA = matrixSize<T>(m, k);
+    size_t sizeB = matrixSize<T>(k, n);
+    size_t sizeC = matrixSize<T>(m, n);
+
+    TypedBuffer<T> va = asTyped<T>(a, "a");
+    TypedBuffer<T> vb = asTyped<T>(b, "b");
+    if (va.size != sizeA || vb.size != sizeB) {
+        throw std::runtime_error("Buffer sizes do not match the given matrix dimensions");
+    }
+
+    auto result = outputTyped<T>(out, sizeC);
+    TypedBuffer<T> vr = asTyped<T>(result, "out");
+    if (overlaps(vr, va) || overlaps(vr, vb)) {
+        throw std::runtime_error("Output buffer must not overlap the inputs");
+    }
+
+    linalg::gemm(BasicMatrixView<const T>(va.data, m, k), BasicMatrixView<const T>(vb.data, k, n), BasicMatrixView<T>(vr.data, m, n));
+    return result;
+}
+
+// === ZERO-COPY BUFFER VARIANTS ===
+std::shared_ptr<ArrayBuffer> HybridMath::matrixMultiplyBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return multiplyBuffer<double>(a, b, rows, inner, cols, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::matrixTransposeBuffer(const std::shared_ptr<ArrayBuffer>& matrix, double rows, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t m = toSize(rows, "rows");
+    size_t n = toSize(cols, "cols");
+    size_t size = matrixSize<double>(m, n);
+
+    Float64Buffer v = asFloat64(matrix, "matrix");
+    if (v.size != size) {
+        throw std::runtime_error("Buffer size does not match the given matrix dimensions");
+    }
+
+    auto result = outputFloat64(out, size);
+    Float64Buffer vr = asFloat64(result, "out");
+    if (overlaps(vr, v)) {
+        throw std::runtime_error("Output buffer must not overlap the input");
+    }
+
+    linalg::transpose(ConstMatrixView(v.data, m, n), MatrixView(vr.data, n, m));
+    return result;
+}
+
+// === FLOAT32 BUFFER VARIANTS ===
+std::shared_ptr<ArrayBuffer> HybridMath::matrixMultiplyBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return multiplyBuffer<float>(a, b, rows, inner, cols, out);
+}
+
+// === ASYNC VARIANTS ===
+// Arguments are captured by value; jobs never see JS-owned memory
+std::shared_ptr<Promise<std::vector<std::vector<double>>>> HybridMath::matrixMultiplyAsync(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
+    return _tasks.run<std::vector<std::vector<double>>>([this, a, b] { return matrixMultiply(a, b); });
+}
+
+std::shared_ptr<Promise<std::vector<std::vector<double>>>> HybridMath::matrixInverseAsync(const std::vector<std::vector<double>>& matrix) {
+    return _tasks.run<std::vector<std::vector<double>>>([this, matrix] { return matrixInverse(matrix); });
+}
+
+std::shared_ptr<Promise<std::vector<double>>> HybridMath::matrixSolveAsync(const std::vector<std::vector<double>>& A, const std::vector<double>& b) {
+    return _tasks.run<std::vector<double>>([this, A, b] { return matrixSolve(A, b); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridMath::matrixMultiplyBufferAsync(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols) {
+    auto a_copy = copyFloat64(a, "a");
+    auto b_copy = copyFloat64(b, "b");
+    return _tasks.run<std::shared_ptr<ArrayBuffer>>([this, a_copy, b_copy, rows, inner, cols] {
+        return matrixMultiplyBuffer(a_copy, b_copy, rows, inner, cols, std::nullopt);
+    });
 }
 
 } // namespace margelo::nitro::rnmath
@@ -1,11 +1,176 @@
 #include "HybridMath.hpp"
+#include "../utils/BufferUtils.hpp"
+#include "../utils/VectorMath.hpp"
+#include "../utils/ElementwiseUtils.hpp"
+#include "../statistics/Moments.hpp"
+#include "Expression.hpp"
+#include "HybridExpression.hpp"
+#include "HybridNativeArray.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <numeric>
 #include <cmath>
+#include <limits>
+#include <string>
 
 namespace margelo::nitro::rnmath {
 
+// Raw kernels shared by the std::vector and ArrayBuffer entry points.
+// Reductions accumulate in double for either element type; products of two
+// floats are exact in double, so float32 input loses nothing extra there.
+template <typename T>
+static double dot(const T* a, const T* b, size_t n) {
+    double result = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        result += static_cast<double>(a[i]) * b[i];
+    }
+    return result;
+}
+
+template <typename T>
+static double norm(const T* v, size_t n, double p) {
+    if (n == 0) return 0.0;
+
+    if (p == 2.0) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double x = v[i];
+            sum += x * x;
+        }
+        return std::sqrt(sum);
+    } else if (p == 1.0) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            sum += std::abs(static_cast<double>(v[i]));
+        }
+        return sum;
+    } else if (p == std::numeric_limits<double>::infinity()) {
+        double max_val = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            max_val = std::max(max_val, std::abs(static_cast<double>(v[i])));
+        }
+        return max_val;
+    } else {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            sum += std::pow(std::abs(static_cast<double>(v[i])), p);
+        }
+        return std::pow(sum, 1.0 / p);
+    }
+}
+
+// Element-wise kernels are safe to run with `out` aliasing an input
+template <typename T>
+static void addElements(const T* a, const T* b, T* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <typename T>
+static void subtractElements(const T* a, const T* b, T* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+template <typename T>
+static void scaleElements(const T* v, T scalar, T* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = v[i] * scalar;
+    }
+}
+
+// Buffer entry points for either element type
+template <typename T>
+static double dotBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) {
+    TypedBuffer<T> va = asTyped<T>(a, "a");
+    TypedBuffer<T> vb = asTyped<T>(b, "b");
+    if (va.size != vb.size) {
+        throw std::runtime_error("Vectors must have same size for dot product");
+    }
+    return dot(va.data, vb.data, va.size);
+}
+
+template <typename T>
+static double normBuffer(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) {
+    TypedBuffer<T> v = asTyped<T>(vector, "vector");
+    return norm(v.data, v.size, p.value_or(2.0));
+}
+
+template <typename T>
+static double sumBuffer(const std::shared_ptr<ArrayBuffer>& vector) {
+    TypedBuffer<T> v = asTyped<T>(vector, "vector");
+    return std::accumulate(v.begin(), v.end(), 0.0);
+}
+
+template <typename T>
+static std::shared_ptr<ArrayBuffer> addBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    TypedBuffer<T> va = asTyped<T>(a, "a");
+    TypedBuffer<T> vb = asTyped<T>(b, "b");
+    if (va.size != vb.size) {
+        throw std::runtime_error("Vectors must have same size for addition");
+    }
+
+    auto result = outputTyped<T>(out, va.size);
+    addElements(va.data, vb.data, asTyped<T>(result, "out").data, va.size);
+    return result;
+}
+
+template <typename T>
+static std::shared_ptr<ArrayBuffer> subtractBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    TypedBuffer<T> va = asTyped<T>(a, "a");
+    TypedBuffer<T> vb = asTyped<T>(b, "b");
+    if (va.size != vb.size) {
+        throw std::runtime_error("Vectors must have same size for subtraction");
+    }
+
+    auto result = outputTyped<T>(out, va.size);
+    subtractElements(va.data, vb.data, asTyped<T>(result, "out").data, va.size);
+    return result;
+}
+
+template <typename T>
+static std::shared_ptr<ArrayBuffer> scaleBuffer(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    TypedBuffer<T> v = asTyped<T>(vector, "vector");
+
+    auto result = outputTyped<T>(out, v.size);
+    scaleElements(v.data, static_cast<T>(scalar), asTyped<T>(result, "out").data, v.size);
+    return result;
+}
+
+// Element-wise maps may run in place, but a shifted overlap would read values already written
+static Float64Buffer mapOutput(const Float64Buffer& v, const std::shared_ptr<ArrayBuffer>& result) {
+    Float64Buffer vr = asFloat64(result, "out");
+    if (vr.data != v.data && overlaps(vr, v)) {
+        throw std::runtime_error("Output buffer must be the input itself or not overlap it");
+    }
+    return vr;
+}
+
+static linalg::Expression::Op toExpressionOp(ExpressionOp op) {
+    switch (op) {
+        case ExpressionOp::INPUT: return linalg::Expression::Op::Input;
+        case ExpressionOp::CONSTANT: return linalg::Expression::Op::Constant;
+        case ExpressionOp::ADD: return linalg::Expression::Op::Add;
+        case ExpressionOp::SUB: return linalg::Expression::Op::Subtract;
+        case ExpressionOp::MUL: return linalg::Expression::Op::Multiply;
+        case ExpressionOp::DIV: return linalg::Expression::Op::Divide;
+        case ExpressionOp::MIN: return linalg::Expression::Op::Min;
+        case ExpressionOp::MAX: return linalg::Expression::Op::Max;
+        case ExpressionOp::NEG: return linalg::Expression::Op::Negate;
+        case ExpressionOp::MAP: return linalg::Expression::Op::Map;
+        case ExpressionOp::POW: return linalg::Expression::Op::Pow;
+    }
+    throw std::runtime_error("Unknown expression op");
+}
+
+// Missing or malformed operands point at the node itself, which Expression rejects
+static size_t toOperand(std::optional<double> index, size_t self) {
+    if (!index || !(*index >= 0.0 && *index < static_cast<double>(self)) || *index != std::floor(*index)) return self;
+    return static_cast<size_t>(*index);
+}
+
 
 std::vector<double> HybridMath::vectorCreate(const std::vector<double>& elements) {
     return elements;
@@ -15,12 +180,7 @@ double HybridMath::vectorDotProduct(const std::vector<double>& a, const std::vec
     if (a.size() != b.size()) {
         throw std::runtime_error("Vectors must have same size for dot product");
     }
-    
-    double result = 0.0;
-    for (size_t i = 0; i < a.size(); i++) {
-        result += a[i] * b[i];
-    }
-    return result;
+    return dot(a.data(), b.data(), a.size());
 }
 
 std::vector<double> HybridMath::vectorCrossProduct(const std::vector<double>& a, const std::vector<double>& b) {
@@ -36,35 +196,7 @@ std::vector<double> HybridMath::vectorCrossProduct(const std::vector<double>& a,
 }
 
 double HybridMath::vectorNorm(const std::vector<double>& vector, std::optional<double> p) {
-    if (vector.empty()) return 0.0;
-    
-    double p_val = p.value_or(2.0); // Default to L2 norm
-    
-    if (p_val == 2.0) {
-        double sum = 0.0;
-        for (double value : vector) {
-            sum += value * value;
-        }
-        return std::sqrt(sum);
-    } else if (p_val == 1.0) {
-        double sum = 0.0;
-        for (double value : vector) {
-            sum += std::abs(value);
-        }
-        return sum;
-    } else if (p_val == std::numeric_limits<double>::infinity()) {
-        double max_val = 0.0;
-        for (double value : vector) {
-            max_val = std::max(max_val, std::abs(value));
-        }
-        return max_val;
-    } else {
-        double sum = 0.0;
-        for (double value : vector) {
-            sum += std::pow(std::abs(value), p_val);
-        }
-        return std::pow(sum, 1.0 / p_val);
-    }
+    return norm(vector.data(), vector.size(), p.value_or(2.0)); // Default to L2 norm
 }
 
 std::vector<double> HybridMath::vectorNormalize(const std::vector<double>& vector) {
@@ -84,9 +216,7 @@ std::vector<double> HybridMath::vectorAdd(const std::vector<double>& a, const st
     }
     
     std::vector<double> result(a.size());
-    for (size_t i = 0; i < a.size(); i++) {
-        result[i] = a[i] + b[i];
-    }
+    addElements(a.data(), b.data(), result.data(), a.size());
     return result;
 }
 
@@ -96,17 +226,13 @@ std::vector<double> HybridMath::vectorSubtract(const std::vector<double>& a, con
     }
     
     std::vector<double> result(a.size());
-    for (size_t i = 0; i < a.size(); i++) {
-        result[i] = a[i] - b[i];
-    }
+    subtractElements(a.data(), b.data(), result.data(), a.size());
     return result;
 }
 
 std::vector<double> HybridMath::vectorScale(const std::vector<double>& vector, double scalar) {
     std::vector<double> result(vector.size());
-    for (size_t i = 0; i < vector.size(); i++) {
-        result[i] = vector[i] * scalar;
-    }
+    scaleElements(vector.data(), scalar, result.data(), vector.size());
     return result;
 }
 
@@ -115,21 +241,12 @@ double HybridMath::vectorSum(const std::vector<double>& vector) {
 }
 
 double HybridMath::vectorMean(const std::vector<double>& vector) {
-    if (vector.empty()) return 0.0;
-    return vectorSum(vector) / vector.size();
+    return stats::moments(vector.data(), vector.size()).mean;
 }
 
 double HybridMath::vectorVariance(const std::vector<double>& vector, std::optional<bool> population) {
-    if (vector.empty()) return 0.0;
-    
-    bool pop = population.value_or(false); // Default to sample variance
-    double mean = vectorMean(vector);
-    double sum_sq = 0.0;
-    for (double value : vector) {
-        sum_sq += (value - mean) * (value - mean);
-    }
-    
-    return pop ? sum_sq / vector.size() : sum_sq / (vector.size() - 1);
+    // Sample variance by default
+    return stats::moments(vector.data(), vector.size()).variance(population.value_or(false));
 }
 
 double HybridMath::vectorStandardDeviation(const std::vector<double>& vector, std::optional<bool> population) {
@@ -146,4 +263,102 @@ double HybridMath::vectorMax(const std::vector<double>& vector) {
     return *std::max_element(vector.begin(), vector.end());
 }
 
+std::vector<double> HybridMath::vectorMap(ElementwiseFunction fn, const std::vector<double>& vector) {
+    std::vector<double> result(vector.size());
+    vmath::map(toVmath(fn), vector.data(), result.data(), vector.size());
+    return result;
+}
+
+std::vector<double> HybridMath::vectorPow(const std::vector<double>& vector, double exponent) {
+    std::vector<double> result(vector.size());
+    vmath::power(vector.data(), exponent, result.data(), vector.size());
+    return result;
+}
+
+std::shared_ptr<HybridExpressionSpec> HybridMath::compileExpression(const std::vector<ExpressionNode>& nodes) {
+    std::vector<linalg::Expression::Node> compiled(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const ExpressionNode& node = nodes[i];
+        linalg::Expression::Node& c = compiled[i];
+        c.op = toExpressionOp(node.op);
+        c.a = toOperand(node.a, i);
+        c.b = toOperand(node.b, i);
+        if ((node.op == ExpressionOp::CONSTANT || node.op == ExpressionOp::POW) && !node.value) {
+            throw std::runtime_error("Expression node " + std::to_string(i) + " needs a value");
+        }
+        c.value = node.value.value_or(0.0);
+        if (node.op == ExpressionOp::MAP) {
+            if (!node.fn) throw std::runtime_error("Expression node " + std::to_string(i) + " needs a function");
+            c.fn = toVmath(*node.fn);
+        }
+    }
+    return std::make_shared<HybridExpression>(std::make_unique<linalg::Expression>(compiled));
+}
+
+// === ZERO-COPY BUFFER VARIANTS ===
+double HybridMath::vectorDotProductBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) {
+    return dotBuffer<double>(a, b);
+}
+
+double HybridMath::vectorNormBuffer(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) {
+    return normBuffer<double>(vector, p);
+}
+
+double HybridMath::vectorSumBuffer(const std::shared_ptr<ArrayBuffer>& vector) {
+    return sumBuffer<double>(vector);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorAddBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return addBuffer<double>(a, b, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorSubtractBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return subtractBuffer<double>(a, b, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorScaleBuffer(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return scaleBuffer<double>(vector, scalar, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorMapBuffer(ElementwiseFunction fn, const std::shared_ptr<ArrayBuffer>& vector, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    Float64Buffer v = asFloat64(vector, "vector");
+
+    auto result = outputFloat64(out, v.size);
+    vmath::map(toVmath(fn), v.data, mapOutput(v, result).data, v.size);
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorPowBuffer(const std::shared_ptr<ArrayBuffer>& vector, double exponent, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    Float64Buffer v = asFloat64(vector, "vector");
+
+    auto result = outputFloat64(out, v.size);
+    vmath::power(v.data, exponent, mapOutput(v, result).data, v.size);
+    return result;
+}
+
+// === FLOAT32 BUFFER VARIANTS ===
+double HybridMath::vectorDotProductBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) {
+    return dotBuffer<float>(a, b);
+}
+
+double HybridMath::vectorNormBufferF32(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) {
+    return normBuffer<float>(vector, p);
+}
+
+double HybridMath::vectorSumBufferF32(const std::shared_ptr<ArrayBuffer>& vector) {
+    return sumBuffer<float>(vector);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorAddBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return addBuffer<float>(a, b, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorSubtractBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return subtractBuffer<float>(a, b, out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::vectorScaleBufferF32(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return scaleBuffer<float>(vector, scalar, out);
+}
+
 } // namespace margelo::nitro::rnmath
@@ -0,0 +1,53 @@
+#include "HybridNeuralNetwork.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+HybridNeuralNetwork::HybridNeuralNetwork(std::unique_ptr<const ml::NeuralNetwork> network) : HybridObject(TAG), _network(std::move(network)) { }
+
+
+double HybridNeuralNetwork::getInputSize() {
+    return static_cast<double>(_network->inputSize());
+}
+
+double HybridNeuralNetwork::getOutputSize() {
+    return static_cast<double>(_network->outputSize());
+}
+
+double HybridNeuralNetwork::getLayers() {
+    return static_cast<double>(_network->layerCount());
+}
+
+std::vector<std::vector<double>> HybridNeuralNetwork::forward(const std::vector<std::vector<double>>& batch) {
+    Matrix input = Matrix::fromRows(batch);
+
+    Matrix result(input.rows(), _network->outputSize());
+    _network->forward(input, result);
+    return result.toRows();
+}
+
+std::shared_ptr<ArrayBuffer> HybridNeuralNetwork::forwardBuffer(const std::shared_ptr<ArrayBuffer>& batch, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t inputs = _network->inputSize();
+    Float64Buffer x = asFloat64(batch, "batch");
+    if (x.size % inputs != 0) {
+        throw std::runtime_error("batch size is not a multiple of the input size " + std::to_string(inputs));
+    }
+    size_t rows = x.size / inputs;
+
+    auto result = outputFloat64(out, rows * _network->outputSize());
+    Float64Buffer y = asFloat64(result, "out");
+    if (overlaps(y, x)) {
+        throw std::runtime_error("Output buffer must not overlap the input");
+    }
+
+    _network->forward(ConstMatrixView(x.data, rows, inputs), MatrixView(y.data, rows, _network->outputSize()));
+    return result;
+}
+
+size_t HybridNeuralNetwork::getExternalMemorySize() noexcept {
+    return _network->memorySize();
+}
+
+} // namespace margelo::nitro::rnmath
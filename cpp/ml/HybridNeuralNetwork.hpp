@@ -0,0 +1,29 @@
+#pragma once
+
+#include "HybridNeuralNetworkSpec.hpp"
+#include "NeuralNetwork.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a network whose weights live in native memory
+class HybridNeuralNetwork : public HybridNeuralNetworkSpec {
+public:
+    explicit HybridNeuralNetwork(std::unique_ptr<const ml::NeuralNetwork> network);
+
+    double getInputSize() override;
+    double getOutputSize() override;
+    double getLayers() override;
+
+    std::vector<std::vector<double>> forward(const std::vector<std::vector<double>>& batch) override;
+    std::shared_ptr<ArrayBuffer> forwardBuffer(const std::shared_ptr<ArrayBuffer>& batch, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    std::unique_ptr<const ml::NeuralNetwork> _network;
+};
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,80 @@
+#include "HybridOnlineRegression.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+HybridOnlineRegression::HybridOnlineRegression(size_t features, double forgetting, double ridge)
+    : HybridObject(TAG), _moments(features), _forgetting(forgetting), _ridge(ridge) { }
+
+
+double HybridOnlineRegression::getFeatures() {
+    return static_cast<double>(_moments.features());
+}
+
+double HybridOnlineRegression::getForgetting() {
+    return _forgetting;
+}
+
+double HybridOnlineRegression::getWeight() {
+    return _moments.weight();
+}
+
+void HybridOnlineRegression::update(const std::vector<std::vector<double>>& X, const std::vector<double>& y) {
+    if (X.size() != y.size()) {
+        throw std::runtime_error("X and y must have same number of samples");
+    }
+    if (X.empty()) return;
+
+    Matrix x = Matrix::fromRows(X);
+    if (x.cols() != _moments.features()) {
+        throw std::runtime_error("Expected " + std::to_string(_moments.features()) + " features per sample, got " + std::to_string(x.cols()));
+    }
+
+    _moments.add(x, y.data(), _forgetting);
+    _coefficients.reset();
+}
+
+void HybridOnlineRegression::updateBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y) {
+    size_t p = _moments.features();
+    Float64Buffer vx = asFloat64(X, "X");
+    Float64Buffer vy = asFloat64(y, "y");
+    if (vx.size != vy.size * p) {
+        throw std::runtime_error("X must hold features * y.length values");
+    }
+    if (vy.size == 0) return;
+
+    _moments.add(ConstMatrixView(vx.data, vy.size, p), vy.data, _forgetting);
+    _coefficients.reset();
+}
+
+std::vector<double> HybridOnlineRegression::coefficients() {
+    if (!_coefficients.has_value()) {
+        _coefficients = _moments.solve(_ridge);
+    }
+    return _coefficients.value();
+}
+
+std::vector<double> HybridOnlineRegression::predict(const std::vector<std::vector<double>>& X) {
+    Matrix x = Matrix::fromRows(X);
+    if (x.cols() != _moments.features()) {
+        throw std::runtime_error("Expected " + std::to_string(_moments.features()) + " features per sample, got " + std::to_string(x.cols()));
+    }
+
+    std::vector<double> w = coefficients();
+    std::vector<double> result(x.rows());
+    ml::predictLinear(x, w.data(), result.data());
+    return result;
+}
+
+void HybridOnlineRegression::reset() {
+    _moments.reset();
+    _coefficients.reset();
+}
+
+size_t HybridOnlineRegression::getExternalMemorySize() noexcept {
+    return _moments.memorySize();
+}
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "HybridOnlineRegressionSpec.hpp"
+#include "Regression.hpp"
+#include <vector>
+#include <optional>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a least-squares fit that is updated incrementally
+class HybridOnlineRegression : public HybridOnlineRegressionSpec {
+public:
+    HybridOnlineRegression(size_t features, double forgetting, double ridge);
+
+    double getFeatures() override;
+    double getForgetting() override;
+    double getWeight() override;
+
+    void update(const std::vector<std::vector<double>>& X, const std::vector<double>& y) override;
+    void updateBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y) override;
+    std::vector<double> coefficients() override;
+    std::vector<double> predict(const std::vector<std::vector<double>>& X) override;
+    void reset() override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    ml::RegressionMoments _moments;
+    double _forgetting;
+    double _ridge;
+    // Solved lazily and kept until the next update
+    std::optional<std::vector<double>> _coefficients;
+};
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,260 @@
+#include "KMeans.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <functional>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define RNMATH_KMEANS_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RNMATH_KMEANS_SSE2 1
+#endif
+
+namespace margelo::nitro::rnmath::ml {
+
+// Points per parallel task. Fixed rather than derived from the core count so
+// that partial sums are always combined in the same order.
+static constexpr size_t KMEANS_CHUNK = 4096;
+
+
+static double squaredDistance(const double* a, const double* b, size_t d) {
+    size_t j = 0;
+    double sum = 0.0;
+#if RNMATH_KMEANS_NEON
+    float64x2_t acc0 = vdupq_n_f64(0.0), acc1 = vdupq_n_f64(0.0);
+    for (; j + 4 <= d; j += 4) {
+        float64x2_t d0 = vsubq_f64(vld1q_f64(a + j), vld1q_f64(b + j));
+        float64x2_t d1 = vsubq_f64(vld1q_f64(a + j + 2), vld1q_f64(b + j + 2));
+        acc0 = vfmaq_f64(acc0, d0, d0);
+        acc1 = vfmaq_f64(acc1, d1, d1);
+    }
+    sum = vaddvq_f64(vaddq_f64(acc0, acc1));
+#elif RNMATH_KMEANS_SSE2
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    for (; j + 4 <= d; j += 4) {
+        __m128d d0 = _mm_sub_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j));
+        __m128d d1 = _mm_sub_pd(_mm_loadu_pd(a + j + 2), _mm_loadu_pd(b + j + 2));
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(d0, d0));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(d1, d1));
+    }
+    __m128d acc = _mm_add_pd(acc0, acc1);
+    sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+#endif
+    for (; j < d; j++) {
+        double diff = a[j] - b[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// Runs fn(chunk, begin, end) over the fixed chunks of [0, n)
+static void forEachChunk(size_t n, const std::function<void(size_t, size_t, size_t)>& fn) {
+    size_t chunks = (n + KMEANS_CHUNK - 1) / KMEANS_CHUNK;
+    ThreadPool::shared().parallelFor(chunks, 1, [&](size_t c0, size_t c1) {
+        for (size_t c = c0; c < c1; c++) {
+            fn(c, c * KMEANS_CHUNK, std::min(n, (c + 1) * KMEANS_CHUNK));
+        }
+    });
+}
+
+// k-means++: every next centroid is a point drawn with probability
+// proportional to its squared distance from the closest centroid so far
+static void seedCentroids(ConstMatrixView points, MatrixView centroids, std::mt19937_64& rng) {
+    size_t n = points.rows, d = points.cols, k = centroids.rows;
+    size_t chunks = (n + KMEANS_CHUNK - 1) / KMEANS_CHUNK;
+    std::vector<double> nearest(n, std::numeric_limits<double>::infinity());
+    std::vector<double> chunk_sums(chunks);
+
+    size_t chosen = std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+    for (size_t c = 0; c < k; c++) {
+        std::copy_n(points.row(chosen), d, centroids.row(c));
+        if (c + 1 == k) break;
+
+        const double* centroid = centroids.row(c);
+        forEachChunk(n, [&](size_t chunk, size_t begin, size_t end) {
+            double sum = 0.0;
+            for (size_t i = begin; i < end; i++) {
+                nearest[i] = std::min(nearest[i], squaredDistance(points.row(i), centroid, d));
+                sum += nearest[i];
+            }
+            chunk_sums[chunk] = sum;
+        });
+
+        double total = 0.0;
+        for (double s : chunk_sums) total += s;
+        if (!(total > 0.0)) {
+            // Every point sits on a centroid already
+            chosen = std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+            continue;
+        }
+
+        double target = std::uniform_real_distribution<double>(0.0, total)(rng);
+        size_t chunk = 0;
+        while (chunk + 1 < chunks && target >= chunk_sums[chunk]) {
+            target -= chunk_sums[chunk++];
+        }
+        size_t end = std::min(n, (chunk + 1) * KMEANS_CHUNK);
+        chosen = end - 1;
+        for (size_t i = chunk * KMEANS_CHUNK; i < end; i++) {
+            if (target < nearest[i]) {
+                chosen = i;
+                break;
+            }
+            target -= nearest[i];
+        }
+    }
+}
+
+Clustering kmeans(ConstMatrixView points, size_t k, size_t max_iterations, uint64_t seed) {
+    size_t n = points.rows, d = points.cols;
+    if (n == 0) {
+        throw std::runtime_error("Cannot cluster empty data");
+    }
+    if (k == 0 || k > n) {
+        throw std::runtime_error("k must be between 1 and the number of points");
+    }
+
+    Clustering result;
+    result.centroids = Matrix(k, d);
+    result.labels.assign(n, 0);
+    MatrixView centroids = result.centroids;
+    std::vector<int32_t>& labels = result.labels;
+
+    std::mt19937_64 rng(seed);
+    seedCentroids(points, centroids, rng);
+
+    // Hamerly's bounds: `upper` on the distance to the own centroid, `lower`
+    // on the distance to every other one. A point whose upper bound is below
+    // both its lower bound and half the gap to the nearest other centroid
+    // cannot change cluster and is skipped.
+    std::vector<double> upper(n), lower(n);
+    std::vector<double> half_gap(k), moved(k);
+    std::vector<double> sums(k * d);
+    std::vector<size_t> counts(k);
+    std::vector<double> previous(d);
+    std::vector<size_t> relocated;
+    std::vector<size_t> chunk_changes((n + KMEANS_CHUNK - 1) / KMEANS_CHUNK);
+
+    auto assign = [&](size_t i) {
+        const double* x = points.row(i);
+        double best = std::numeric_limits<double>::infinity();
+        double second = best;
+        size_t best_index = 0;
+        for (size_t c = 0; c < k; c++) {
+            double dist = squaredDistance(x, centroids.row(c), d);
+            if (dist < best) {
+                second = best;
+                best = dist;
+                best_index = c;
+            } else if (dist < second) {
+                second = dist;
+            }
+        }
+        bool changed = labels[i] != static_cast<int32_t>(best_index);
+        labels[i] = static_cast<int32_t>(best_index);
+        upper[i] = std::sqrt(best);
+        lower[i] = std::sqrt(second);
+        return changed;
+    };
+
+    forEachChunk(n, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) assign(i);
+    });
+
+    ThreadPool& pool = ThreadPool::shared();
+    size_t iteration = 0;
+    while (iteration < max_iterations) {
+        iteration++;
+
+        // Centroids are the means of their points. Split by dimension so
+        // every sum is accumulated in point order.
+        std::fill(counts.begin(), counts.end(), 0);
+        for (size_t i = 0; i < n; i++) counts[labels[i]]++;
+        pool.parallelFor(d, pool.grainFor(d, 1), [&](size_t j0, size_t j1) {
+            for (size_t c = 0; c < k; c++) std::fill(&sums[c * d + j0], &sums[c * d + j1], 0.0);
+            for (size_t i = 0; i < n; i++) {
+                const double* x = points.row(i);
+                double* s = &sums[labels[i] * d];
+                for (size_t j = j0; j < j1; j++) s[j] += x[j];
+            }
+        });
+
+        relocated.clear();
+        for (size_t c = 0; c < k; c++) {
+            std::copy_n(centroids.row(c), d, previous.begin());
+            if (counts[c] > 0) {
+                double inv = 1.0 / static_cast<double>(counts[c]);
+                for (size_t j = 0; j < d; j++) centroids(c, j) = sums[c * d + j] * inv;
+            } else {
+                // Restart an empty cluster at the point farthest from its centroid.
+                // The bounds stay valid, the move is accounted for below.
+                size_t far = n;
+                for (size_t i = 0; i < n; i++) {
+                    if ((far == n || upper[i] > upper[far]) && std::find(relocated.begin(), relocated.end(), i) == relocated.end()) far = i;
+                }
+                relocated.push_back(far);
+                std::copy_n(points.row(far), d, centroids.row(c));
+            }
+            moved[c] = std::sqrt(squaredDistance(previous.data(), centroids.row(c), d));
+        }
+
+        // Moving centroids loosen the bounds by at most how far they moved
+        size_t farthest = 0;
+        for (size_t c = 1; c < k; c++) {
+            if (moved[c] > moved[farthest]) farthest = c;
+        }
+        double runner_up = 0.0;
+        for (size_t c = 0; c < k; c++) {
+            if (c != farthest) runner_up = std::max(runner_up, moved[c]);
+        }
+        for (size_t c = 0; c < k; c++) {
+            double nearest = std::numeric_limits<double>::infinity();
+            for (size_t o = 0; o < k; o++) {
+                if (o != c) nearest = std::min(nearest, squaredDistance(centroids.row(c), centroids.row(o), d));
+            }
+            half_gap[c] = 0.5 * std::sqrt(nearest);
+        }
+
+        forEachChunk(n, [&](size_t chunk, size_t begin, size_t end) {
+            size_t changes = 0;
+            for (size_t i = begin; i < end; i++) {
+                size_t a = static_cast<size_t>(labels[i]);
+                upper[i] += moved[a];
+                lower[i] -= (a == farthest) ? runner_up : moved[farthest];
+
+                double bound = std::max(half_gap[a], lower[i]);
+                if (upper[i] <= bound) continue;
+                upper[i] = std::sqrt(squaredDistance(points.row(i), centroids.row(a), d));
+                if (upper[i] <= bound) continue;
+                if (assign(i)) changes++;
+            }
+            chunk_changes[chunk] = changes;
+        });
+
+        size_t changes = 0;
+        for (size_t c : chunk_changes) changes += c;
+        if (changes == 0) {
+            result.converged = true;
+            break;
+        }
+    }
+    result.iterations = iteration;
+
+    std::vector<double> chunk_inertia(chunk_changes.size());
+    forEachChunk(n, [&](size_t chunk, size_t begin, size_t end) {
+        double sum = 0.0;
+        for (size_t i = begin; i < end; i++) {
+            sum += squaredDistance(points.row(i), centroids.row(labels[i]), d);
+        }
+        chunk_inertia[chunk] = sum;
+    });
+    for (double s : chunk_inertia) result.inertia += s;
+    return result;
+}
+
+} // namespace margelo::nitro::rnmath::ml
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../algebra/Matrix.hpp"
+#include <vector>
+#include <cstdint>
+
+namespace margelo::nitro::rnmath::ml {
+
+struct Clustering {
+    // k x d
+    Matrix centroids;
+    // Index of the centroid of every point
+    std::vector<int32_t> labels;
+    // Sum of squared distances from the points to their centroids
+    double inertia = 0.0;
+    size_t iterations = 0;
+    // False when max_iterations ran out before the labels settled
+    bool converged = false;
+};
+
+// Lloyd's k-means over the rows of `points`, seeded with k-means++.
+// Assignment uses Hamerly's bounds to skip most distance computations once
+// the centroids stop moving much, and runs on the shared ThreadPool.
+// Work is split into fixed-size chunks, so a given seed gives the same
+// result on every device.
+Clustering kmeans(ConstMatrixView points, size_t k, size_t max_iterations, uint64_t seed);
+
+} // namespace margelo::nitro::rnmath::ml
@@ -1,47 +1,149 @@
 #include "HybridMath.hpp"
+#include "Regression.hpp"
+#include "HybridOnlineRegression.hpp"
+#include "KMeans.hpp"
+#include "NeuralNetwork.hpp"
+#include "HybridNeuralNetwork.hpp"
+#include "../utils/BufferUtils.hpp"
 #include <stdexcept>
 #include <vector>
+#include <string>
+#include <cmath>
+#include <cstring>
+#include <random>
 
 namespace margelo::nitro::rnmath {
 
-std::vector<double> HybridMath::linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y) {
-    
-    // Simple linear regression for y = mx + b
+static ml::RegressionSolver toRegressionSolver(std::optional<RegressionMethod> method) {
+    return method.value_or(RegressionMethod::NORMAL) == RegressionMethod::QR ? ml::RegressionSolver::QR : ml::RegressionSolver::NormalEquations;
+}
+
+static ml::Activation toActivation(Activation activation) {
+    switch (activation) {
+        case Activation::RELU: return ml::Activation::ReLU;
+        case Activation::TANH: return ml::Activation::Tanh;
+        case Activation::SIGMOID: return ml::Activation::Sigmoid;
+        case Activation::SOFTMAX: return ml::Activation::Softmax;
+        default: return ml::Activation::Linear;
+    }
+}
+
+// Coefficients are [w_1, ..., w_p, intercept]
+static void checkCoefficients(const std::vector<double>& coefficients, size_t features) {
+    if (coefficients.size() != features + 1) {
+        throw std::runtime_error("Expected " + std::to_string(features + 1) + " coefficients (one per feature plus the intercept), got " + std::to_string(coefficients.size()));
+    }
+}
+
+
+std::vector<double> HybridMath::linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) {
     if (X.size() != y.size()) {
         throw std::runtime_error("X and y must have same number of samples");
     }
-    
     if (X.empty()) {
         throw std::runtime_error("Cannot perform regression on empty data");
     }
-    
-    // For simple case: assume X has one feature per sample
-    double sum_x = 0.0, sum_y = 0.0, sum_xy = 0.0, sum_xx = 0.0;
-    size_t n = X.size();
-    
-    for (size_t i = 0; i < n; i++) {
-        if (X[i].size() != 1) {
-            throw std::runtime_error("Only single feature regression implemented");
-        }
-        
-        double x_val = X[i][0];
-        double y_val = y[i];
-        
-        sum_x += x_val;
-        sum_y += y_val;
-        sum_xy += x_val * y_val;
-        sum_xx += x_val * x_val;
-    }
-    
-    double denominator = n * sum_xx - sum_x * sum_x;
-    if (denominator == 0) {
-        throw std::runtime_error("Cannot compute regression for collinear data");
-    }
-    
-    double slope = (n * sum_xy - sum_x * sum_y) / denominator;
-    double intercept = (sum_y - slope * sum_x) / n;
-    
-    return {slope, intercept};
+
+    Matrix x = Matrix::fromRows(X);
+    return ml::fitLinear(x, y.data(), ridge.value_or(0.0), toRegressionSolver(method));
+}
+
+std::vector<double> HybridMath::linearRegressionPredict(const std::vector<std::vector<double>>& X, const std::vector<double>& coefficients) {
+    Matrix x = Matrix::fromRows(X);
+    checkCoefficients(coefficients, x.cols());
+
+    std::vector<double> result(x.rows());
+    ml::predictLinear(x, coefficients.data(), result.data());
+    return result;
+}
+
+std::shared_ptr<HybridOnlineRegressionSpec> HybridMath::createOnlineRegression(double features, std::optional<double> forgetting, std::optional<double> ridge) {
+    size_t p = toSize(features, "features");
+    double lambda = forgetting.value_or(1.0);
+    if (!(lambda > 0.0 && lambda <= 1.0)) {
+        throw std::runtime_error("Forgetting factor must be in (0, 1]");
+    }
+    double penalty = ridge.value_or(0.0);
+    if (!(penalty >= 0.0) || std::isinf(penalty)) {
+        throw std::runtime_error("Ridge penalty must be a non-negative number");
+    }
+    return std::make_shared<HybridOnlineRegression>(p, lambda, penalty);
+}
+
+std::shared_ptr<HybridNeuralNetworkSpec> HybridMath::createNeuralNetwork(const std::vector<DenseLayer>& layers) {
+    std::vector<ml::DenseLayer> dense;
+    dense.reserve(layers.size());
+    for (const DenseLayer& layer : layers) {
+        dense.push_back(ml::DenseLayer{Matrix::fromRows(layer.weights), layer.bias, toActivation(layer.activation)});
+    }
+    return std::make_shared<HybridNeuralNetwork>(std::make_unique<ml::NeuralNetwork>(std::move(dense)));
+}
+
+// === ZERO-COPY BUFFER VARIANTS ===
+std::vector<double> HybridMath::linearRegressionBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y, double features, std::optional<double> ridge, std::optional<RegressionMethod> method) {
+    size_t p = toSize(features, "features");
+    Float64Buffer vx = asFloat64(X, "X");
+    Float64Buffer vy = asFloat64(y, "y");
+    if (vx.size != vy.size * p) {
+        throw std::runtime_error("X must hold features * y.length values");
+    }
+    if (vy.size == 0) {
+        throw std::runtime_error("Cannot perform regression on empty data");
+    }
+
+    return ml::fitLinear(ConstMatrixView(vx.data, vy.size, p), vy.data, ridge.value_or(0.0), toRegressionSolver(method));
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::linearRegressionPredictBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::vector<double>& coefficients, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    if (coefficients.size() < 2) {
+        throw std::runtime_error("Coefficients must hold at least one feature weight and the intercept");
+    }
+    size_t p = coefficients.size() - 1;
+    Float64Buffer vx = asFloat64(X, "X");
+    if (vx.size % p != 0) {
+        throw std::runtime_error("X size is not a multiple of the feature count " + std::to_string(p));
+    }
+    size_t n = vx.size / p;
+
+    auto result = outputFloat64(out, n);
+    Float64Buffer vr = asFloat64(result, "out");
+    if (overlaps(vr, vx)) {
+        throw std::runtime_error("Output buffer must not overlap the input");
+    }
+
+    ml::predictLinear(ConstMatrixView(vx.data, n, p), coefficients.data(), vr.data);
+    return result;
+}
+
+KMeansResult HybridMath::kmeansBuffer(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) {
+    size_t d = toSize(dimensions, "dimensions");
+    if (d == 0) throw std::runtime_error("dimensions must be positive");
+    Float64Buffer vp = asFloat64(points, "points");
+    if (vp.size % d != 0) {
+        throw std::runtime_error("points size is not a multiple of dimensions");
+    }
+
+    size_t max_iterations = maxIterations.has_value() ? toSize(maxIterations.value(), "maxIterations") : 300;
+    uint64_t rng_seed = seed.has_value() ? toSize(seed.value(), "seed") : std::random_device()();
+    ml::Clustering clustering = ml::kmeans(ConstMatrixView(vp.data, vp.size / d, d), toSize(k, "k"), max_iterations, rng_seed);
+
+    const Matrix& c = clustering.centroids;
+    auto centroids = ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(c.data()), c.size() * sizeof(double));
+    auto labels = ArrayBuffer::allocate(clustering.labels.size() * sizeof(int32_t));
+    std::memcpy(labels->data(), clustering.labels.data(), clustering.labels.size() * sizeof(int32_t));
+    return KMeansResult(centroids, labels, clustering.inertia, static_cast<double>(clustering.iterations), clustering.converged);
+}
+
+// === ASYNC VARIANTS ===
+std::shared_ptr<Promise<std::vector<double>>> HybridMath::linearRegressionAsync(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) {
+    return _tasks.run<std::vector<double>>([this, X, y, ridge, method] { return linearRegression(X, y, ridge, method); });
+}
+
+std::shared_ptr<Promise<KMeansResult>> HybridMath::kmeansBufferAsync(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) {
+    auto points_copy = copyFloat64(points, "points");
+    return _tasks.run<KMeansResult>([this, points_copy, dimensions, k, maxIterations, seed] {
+        return kmeansBuffer(points_copy, dimensions, k, maxIterations, seed);
+    });
 }
 
 } // namespace margelo::nitro::rnmath
@@ -0,0 +1,113 @@
+#include "NeuralNetwork.hpp"
+#include "../algebra/Gemm.hpp"
+#include "../utils/VectorMath.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace margelo::nitro::rnmath::ml {
+
+// Adds the bias and applies an element-wise activation to one output block
+static void biasActivation(MatrixView block, const double* bias, Activation activation) {
+    for (size_t i = 0; i < block.rows; i++) {
+        double* row = block.row(i);
+        for (size_t j = 0; j < block.cols; j++) row[j] += bias[j];
+
+        switch (activation) {
+            case Activation::ReLU:
+                for (size_t j = 0; j < block.cols; j++) row[j] = row[j] > 0.0 ? row[j] : 0.0;
+                break;
+            case Activation::Tanh:
+                vmath::map(vmath::Function::Tanh, row, row, block.cols);
+                break;
+            case Activation::Sigmoid:
+                // 1 / (1 + e^-x); e^-x overflowing to infinity still gives 0
+                for (size_t j = 0; j < block.cols; j++) row[j] = -row[j];
+                vmath::map(vmath::Function::Exp, row, row, block.cols);
+                for (size_t j = 0; j < block.cols; j++) row[j] = 1.0 / (1.0 + row[j]);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// Row-wise softmax, shifted by the row maximum so exp cannot overflow
+static void softmaxRows(MatrixView m) {
+    for (size_t i = 0; i < m.rows; i++) {
+        double* row = m.row(i);
+        double max = *std::max_element(row, row + m.cols);
+        for (size_t j = 0; j < m.cols; j++) row[j] -= max;
+        vmath::map(vmath::Function::Exp, row, row, m.cols);
+        double sum = 0.0;
+        for (size_t j = 0; j < m.cols; j++) sum += row[j];
+        double inv = 1.0 / sum;
+        for (size_t j = 0; j < m.cols; j++) row[j] *= inv;
+    }
+}
+
+
+NeuralNetwork::NeuralNetwork(std::vector<DenseLayer> layers) : _layers(std::move(layers)) {
+    if (_layers.empty()) {
+        throw std::runtime_error("Network needs at least one layer");
+    }
+    for (size_t l = 0; l < _layers.size(); l++) {
+        const DenseLayer& layer = _layers[l];
+        if (layer.weights.rows() == 0 || layer.weights.cols() == 0) {
+            throw std::runtime_error("Layer " + std::to_string(l) + " has empty weights");
+        }
+        if (layer.bias.size() != layer.weights.cols()) {
+            throw std::runtime_error("Layer " + std::to_string(l) + " bias must have one value per output");
+        }
+        if (l > 0 && layer.weights.rows() != _layers[l - 1].weights.cols()) {
+            throw std::runtime_error("Layer " + std::to_string(l) + " expects " + std::to_string(layer.weights.rows()) +
+                                     " inputs but the previous layer has " + std::to_string(_layers[l - 1].weights.cols()) + " outputs");
+        }
+    }
+}
+
+void NeuralNetwork::forward(ConstMatrixView input, MatrixView out) const {
+    if (input.cols != inputSize()) {
+        throw std::runtime_error("Input has " + std::to_string(input.cols) + " features, expected " + std::to_string(inputSize()));
+    }
+    size_t batch = input.rows;
+    if (batch == 0) return;
+
+    // Hidden activations ping-pong between two buffers sized for the widest layer
+    size_t width = 0;
+    for (size_t l = 0; l + 1 < _layers.size(); l++) width = std::max(width, _layers[l].weights.cols());
+    std::vector<double> scratch(_layers.size() > 1 ? batch * width : 0);
+    std::vector<double> scratch2(_layers.size() > 2 ? batch * width : 0);
+
+    ConstMatrixView x = input;
+    for (size_t l = 0; l < _layers.size(); l++) {
+        const DenseLayer& layer = _layers[l];
+        size_t outputs = layer.weights.cols();
+
+        MatrixView y = out;
+        if (l + 1 < _layers.size()) {
+            y = MatrixView((l % 2 == 0 ? scratch : scratch2).data(), batch, outputs);
+        }
+
+        const double* bias = layer.bias.data();
+        Activation activation = layer.activation;
+        linalg::gemm(x, layer.weights, y, 1.0, 0.0, [bias, activation](MatrixView block, size_t, size_t col0) {
+            biasActivation(block, bias + col0, activation);
+        });
+        if (activation == Activation::Softmax) {
+            softmaxRows(y);
+        }
+        x = y;
+    }
+}
+
+size_t NeuralNetwork::memorySize() const {
+    size_t bytes = 0;
+    for (const DenseLayer& layer : _layers) {
+        bytes += (layer.weights.size() + layer.bias.size()) * sizeof(double);
+    }
+    return bytes;
+}
+
+} // namespace margelo::nitro::rnmath::ml
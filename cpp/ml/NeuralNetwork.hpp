@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../algebra/Matrix.hpp"
+#include <vector>
+
+namespace margelo::nitro::rnmath::ml {
+
+enum class Activation { Linear, ReLU, Tanh, Sigmoid, Softmax };
+
+// y = activation(x * weights + bias) for a row vector x
+struct DenseLayer {
+    // inputs x outputs
+    Matrix weights;
+    std::vector<double> bias;
+    Activation activation = Activation::Linear;
+};
+
+// Feed-forward stack of dense layers evaluated on whole batches. Each layer is
+// one GEMM whose epilogue adds the bias and applies the activation to every
+// output block while it is still in cache; softmax, which needs complete
+// rows, runs as a separate pass over the layer's output.
+class NeuralNetwork {
+public:
+    // Throws unless every layer's inputs match the previous layer's outputs
+    explicit NeuralNetwork(std::vector<DenseLayer> layers);
+
+    size_t inputSize() const { return _layers.front().weights.rows(); }
+    size_t outputSize() const { return _layers.back().weights.cols(); }
+    size_t layerCount() const { return _layers.size(); }
+
+    // Maps `input` (batch x inputSize) to `out` (batch x outputSize).
+    // Does not modify the network, so it is safe to call concurrently.
+    void forward(ConstMatrixView input, MatrixView out) const;
+
+    size_t memorySize() const;
+
+private:
+    std::vector<DenseLayer> _layers;
+};
+
+} // namespace margelo::nitro::rnmath::ml
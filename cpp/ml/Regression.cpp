@@ -0,0 +1,194 @@
+#include "Regression.hpp"
+#include "../algebra/Gemm.hpp"
+#include "../algebra/LinearAlgebra.hpp"
+#include "../algebra/Decompositions.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+namespace margelo::nitro::rnmath::ml {
+
+// Samples packed per GEMM while accumulating the normal equations
+static constexpr size_t GRAM_CHUNK = 256;
+// Element count below which prediction stays on the calling thread
+static constexpr size_t PREDICT_MIN_ELEMENTS = size_t(1) << 16;
+
+
+RegressionMoments::RegressionMoments(size_t features)
+    : _features(features), _mean(features + 1, 0.0), _comoment(features + 1, features + 1, 0.0) { }
+
+
+void RegressionMoments::add(ConstMatrixView x, const double* y, double decay) {
+    size_t n = x.rows, p = _features;
+    if (n == 0) return;
+    size_t q = p + 2; // features, target, constant 1
+
+    // Shifting by the first sample keeps the centering below from cancelling
+    // away large offsets
+    std::vector<double> shift(p + 1);
+    std::copy_n(x.row(0), p, shift.begin());
+    shift[p] = y[0];
+
+    // D^T * D for the rows sqrt(w_i) * [x_i - shift, y_i - shift, 1], in one
+    // pass over the samples. Column p + 1 of the result holds the weighted
+    // sums, its last entry the total weight.
+    Matrix gram(q, q, 0.0);
+    Matrix chunk(GRAM_CHUNK, q);
+    Matrix chunk_t(q, GRAM_CHUNK);
+    for (size_t r0 = 0; r0 < n; r0 += GRAM_CHUNK) {
+        size_t rows = std::min(GRAM_CHUNK, n - r0);
+        for (size_t i = 0; i < rows; i++) {
+            // The newest sample has weight 1
+            double w = decay == 1.0 ? 1.0 : std::sqrt(std::pow(decay, static_cast<double>(n - 1 - (r0 + i))));
+            const double* src = x.row(r0 + i);
+            double* dst = chunk.row(i);
+            for (size_t j = 0; j < p; j++) dst[j] = w * (src[j] - shift[j]);
+            dst[p] = w * (y[r0 + i] - shift[p]);
+            dst[p + 1] = w;
+        }
+
+        ConstMatrixView d = chunk.view().block(0, 0, rows, q);
+        MatrixView d_t(chunk_t.data(), q, rows, GRAM_CHUNK);
+        linalg::transpose(d, d_t);
+        linalg::gemm(d_t, d, gram, 1.0, 1.0);
+    }
+
+    double batch_weight = gram(p + 1, p + 1);
+    if (!(batch_weight > 0.0)) return;
+
+    // Earlier samples age by one step per new sample
+    double old_weight = _weight;
+    if (decay != 1.0 && old_weight > 0.0) {
+        double factor = std::pow(decay, static_cast<double>(n));
+        old_weight *= factor;
+        for (size_t k = 0; k < _comoment.size(); k++) _comoment.data()[k] *= factor;
+    }
+
+    // Chan et al.: merge the batch's centered moments into the running ones
+    double total = old_weight + batch_weight;
+    double mix = old_weight * batch_weight / total;
+    std::vector<double> delta(p + 1);
+    for (size_t j = 0; j <= p; j++) {
+        double batch_mean = shift[j] + gram(j, p + 1) / batch_weight;
+        delta[j] = batch_mean - _mean[j];
+        _mean[j] += delta[j] * batch_weight / total;
+    }
+    for (size_t j = 0; j <= p; j++) {
+        for (size_t k = 0; k <= p; k++) {
+            double batch_comoment = gram(j, k) - gram(j, p + 1) * gram(k, p + 1) / batch_weight;
+            _comoment(j, k) += batch_comoment + delta[j] * delta[k] * mix;
+        }
+    }
+    _weight = total;
+}
+
+void RegressionMoments::reset() {
+    _weight = 0.0;
+    std::fill(_mean.begin(), _mean.end(), 0.0);
+    std::fill(_comoment.data(), _comoment.data() + _comoment.size(), 0.0);
+}
+
+std::vector<double> RegressionMoments::solve(double ridge) const {
+    size_t p = _features;
+    if (!(_weight > 0.0)) {
+        throw std::runtime_error("Cannot perform regression on empty data");
+    }
+
+    Matrix a(p, p);
+    std::vector<double> rhs(p);
+    for (size_t j = 0; j < p; j++) {
+        std::copy_n(_comoment.row(j), p, a.row(j));
+        a(j, j) += ridge;
+        rhs[j] = _comoment(j, p);
+    }
+
+    std::vector<double> coefficients(p + 1);
+    try {
+        linalg::Cholesky cholesky(a);
+        cholesky.solve(ConstMatrixView(rhs.data(), p, 1), MatrixView(coefficients.data(), p, 1));
+    } catch (const std::runtime_error&) {
+        throw std::runtime_error("Cannot compute regression for collinear data");
+    }
+
+    double intercept = _mean[p];
+    for (size_t j = 0; j < p; j++) {
+        intercept -= coefficients[j] * _mean[j];
+    }
+    coefficients[p] = intercept;
+    return coefficients;
+}
+
+size_t RegressionMoments::memorySize() const {
+    return (_mean.size() + _comoment.size()) * sizeof(double);
+}
+
+
+static std::vector<double> fitQR(ConstMatrixView x, const double* y, double ridge) {
+    size_t n = x.rows, p = x.cols;
+
+    // Ridge becomes p extra rows sqrt(ridge) * e_j with target 0, none of
+    // which touch the intercept column
+    size_t extra = ridge > 0.0 ? p : 0;
+    size_t m = n + extra;
+    if (m < p + 1) {
+        throw std::runtime_error("Regression needs at least as many samples as coefficients");
+    }
+
+    Matrix design(m, p + 1, 0.0);
+    std::vector<double> target(m, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        std::copy_n(x.row(i), p, design.row(i));
+        design(i, p) = 1.0;
+        target[i] = y[i];
+    }
+    double sqrt_ridge = std::sqrt(ridge);
+    for (size_t j = 0; j < extra; j++) {
+        design(n + j, j) = sqrt_ridge;
+    }
+
+    linalg::QR qr(design);
+    if (qr.isRankDeficient()) {
+        throw std::runtime_error("Cannot compute regression for collinear data");
+    }
+
+    std::vector<double> coefficients(p + 1);
+    qr.solve(ConstMatrixView(target.data(), m, 1), MatrixView(coefficients.data(), p + 1, 1));
+    return coefficients;
+}
+
+std::vector<double> fitLinear(ConstMatrixView x, const double* y, double ridge, RegressionSolver solver) {
+    if (x.rows == 0) {
+        throw std::runtime_error("Cannot perform regression on empty data");
+    }
+    if (!(ridge >= 0.0) || std::isinf(ridge)) {
+        throw std::runtime_error("Ridge penalty must be a non-negative number");
+    }
+
+    if (solver == RegressionSolver::QR) {
+        return fitQR(x, y, ridge);
+    }
+    RegressionMoments moments(x.cols);
+    moments.add(x, y);
+    return moments.solve(ridge);
+}
+
+void predictLinear(ConstMatrixView x, const double* coefficients, double* out) {
+    size_t p = x.cols;
+    double intercept = coefficients[p];
+
+    ThreadPool& pool = ThreadPool::shared();
+    size_t min_rows = std::max<size_t>(1, PREDICT_MIN_ELEMENTS / std::max<size_t>(p, 1));
+    pool.parallelFor(x.rows, pool.grainFor(x.rows, min_rows), [&](size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; i++) {
+            const double* row = x.row(i);
+            double sum = intercept;
+            for (size_t j = 0; j < p; j++) {
+                sum += row[j] * coefficients[j];
+            }
+            out[i] = sum;
+        }
+    });
+}
+
+} // namespace margelo::nitro::rnmath::ml
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../algebra/Matrix.hpp"
+#include <vector>
+
+namespace margelo::nitro::rnmath::ml {
+
+enum class RegressionSolver {
+    // Cholesky on the normal equations: one GEMM pass over X, O(n p^2 + p^3)
+    NormalEquations,
+    // Householder QR of the design matrix: about twice the work and a copy of
+    // X, but accurate for ill-conditioned features
+    QR,
+};
+
+// Weighted means and co-moments of the samples [x, y], which is all a
+// least-squares fit needs. Batches are merged with Chan's update, so the
+// statistics stay centered and never need the raw history again.
+class RegressionMoments {
+public:
+    explicit RegressionMoments(size_t features);
+
+    size_t features() const { return _features; }
+    // Sum of the sample weights
+    double weight() const { return _weight; }
+
+    // Adds the samples in order. With decay < 1 every earlier sample, including
+    // those already added, is down-weighted by `decay` per newer sample.
+    void add(ConstMatrixView x, const double* y, double decay = 1.0);
+    void reset();
+
+    // [w_1, ..., w_p, b] minimizing the weighted squared error plus ridge * |w|^2
+    std::vector<double> solve(double ridge) const;
+
+    size_t memorySize() const;
+
+private:
+    size_t _features;
+    double _weight = 0.0;
+    // Over [x_1, ..., x_p, y]
+    std::vector<double> _mean;
+    Matrix _comoment;
+};
+
+// Ordinary least squares fit of y ~ X * w + b for an n x p design matrix,
+// with an optional ridge penalty `ridge * |w|^2` that leaves b unpenalized.
+// Returns [w_1, ..., w_p, b]. Throws for collinear features without ridge.
+std::vector<double> fitLinear(ConstMatrixView x, const double* y, double ridge, RegressionSolver solver);
+
+// out[i] = X[i] . w + b for coefficients [w_1, ..., w_p, b]
+void predictLinear(ConstMatrixView x, const double* coefficients, double* out);
+
+} // namespace margelo::nitro::rnmath::ml
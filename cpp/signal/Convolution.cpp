@@ -0,0 +1,154 @@
+#include "Convolution.hpp"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace margelo::nitro::rnmath::dsp {
+
+// Relative cost of one real FFT of size L, in units of one direct
+// multiply-accumulate, is roughly FFT_COST_FACTOR * L * log2(L)
+static constexpr double FFT_COST_FACTOR = 1.5;
+// Kernels this short are always convolved directly
+static constexpr size_t DIRECT_MAX_KERNEL = 32;
+
+
+template <typename T>
+static void convolveDirect(const T* signal, size_t signal_size, const T* kernel, size_t kernel_size, T* out) {
+    std::fill_n(out, signal_size + kernel_size - 1, T(0));
+
+    for (size_t i = 0; i < signal_size; i++) {
+        T s = signal[i];
+        T* o = out + i;
+        for (size_t j = 0; j < kernel_size; j++) {
+            o[j] += s * kernel[j];
+        }
+    }
+}
+
+static double fftCost(size_t L) {
+    return FFT_COST_FACTOR * static_cast<double>(L) * std::log2(static_cast<double>(L));
+}
+
+// Cost of overlap-add with FFT size L: one forward and one inverse transform
+// plus a spectrum product per block of L - M + 1 input samples
+static double overlapAddCost(size_t signal_size, size_t kernel_size, size_t L) {
+    size_t block = L - kernel_size + 1;
+    double blocks = std::ceil(static_cast<double>(signal_size) / static_cast<double>(block));
+    return blocks * (2.0 * fftCost(L) + static_cast<double>(L)) + fftCost(L);
+}
+
+// FFT size covering the whole output in a single block
+static size_t singleBlockSize(size_t signal_size, size_t kernel_size) {
+    return nextPowerOfTwo(signal_size + kernel_size - 1);
+}
+
+// Power-of-two FFT size minimizing the overlap-add cost
+static size_t bestBlockSize(size_t signal_size, size_t kernel_size) {
+    size_t largest = singleBlockSize(signal_size, kernel_size);
+    size_t best = largest;
+    double best_cost = overlapAddCost(signal_size, kernel_size, largest);
+
+    for (size_t L = nextPowerOfTwo(2 * kernel_size); L < largest; L <<= 1) {
+        double cost = overlapAddCost(signal_size, kernel_size, L);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = L;
+        }
+    }
+    return best;
+}
+
+template <typename T>
+static void convolveOverlapAdd(const T* signal, size_t signal_size, const T* kernel, size_t kernel_size,
+                               T* out, size_t L, PlanCache<BasicRealFFTPlan<T>>& plans) {
+    auto forward = plans.get(L, FFTDirection::Forward);
+    auto inverse = plans.get(L, FFTDirection::Inverse);
+    size_t bins = L / 2 + 1;
+    size_t block = L - kernel_size + 1;
+
+    std::vector<T> time(L, T(0));
+    std::vector<T> kernel_real(bins), kernel_imag(bins);
+    std::vector<T> spectrum_real(bins), spectrum_imag(bins);
+
+    std::copy_n(kernel, kernel_size, time.begin());
+    forward->forward(time.data(), kernel_real.data(), kernel_imag.data());
+
+    std::fill_n(out, signal_size + kernel_size - 1, T(0));
+
+    for (size_t start = 0; start < signal_size; start += block) {
+        size_t len = std::min(block, signal_size - start);
+        std::copy_n(signal + start, len, time.begin());
+        std::fill(time.begin() + len, time.end(), T(0));
+
+        forward->forward(time.data(), spectrum_real.data(), spectrum_imag.data());
+        for (size_t k = 0; k < bins; k++) {
+            T ar = spectrum_real[k], ai = spectrum_imag[k];
+            spectrum_real[k] = ar * kernel_real[k] - ai * kernel_imag[k];
+            spectrum_imag[k] = ar * kernel_imag[k] + ai * kernel_real[k];
+        }
+        inverse->inverse(spectrum_real.data(), spectrum_imag.data(), time.data());
+
+        // Each block contributes len + M - 1 samples, overlapping the next block's head
+        T* o = out + start;
+        size_t count = len + kernel_size - 1;
+        for (size_t i = 0; i < count; i++) {
+            o[i] += time[i];
+        }
+    }
+}
+
+ConvolutionMethod chooseConvolutionMethod(size_t signal_size, size_t kernel_size) {
+    // Convolution is commutative, so cost depends on the shorter operand as the kernel
+    size_t n = std::max(signal_size, kernel_size);
+    size_t m = std::min(signal_size, kernel_size);
+    if (m <= DIRECT_MAX_KERNEL) return ConvolutionMethod::Direct;
+
+    double direct_cost = static_cast<double>(n) * static_cast<double>(m);
+    size_t L = bestBlockSize(n, m);
+    double fft_cost = overlapAddCost(n, m, L);
+    if (direct_cost <= fft_cost) return ConvolutionMethod::Direct;
+
+    return L == singleBlockSize(n, m) ? ConvolutionMethod::FFT : ConvolutionMethod::OverlapAdd;
+}
+
+template <typename T>
+static void convolveWith(const T* signal, size_t signal_size, const T* kernel, size_t kernel_size,
+                         T* out, ConvolutionMethod method, PlanCache<BasicRealFFTPlan<T>>& plans) {
+    if (signal_size == 0 || kernel_size == 0) return;
+
+    // Block over the longer operand so the fixed spectrum is the short one
+    if (kernel_size > signal_size) {
+        std::swap(signal, kernel);
+        std::swap(signal_size, kernel_size);
+    }
+
+    if (method == ConvolutionMethod::Auto) {
+        method = chooseConvolutionMethod(signal_size, kernel_size);
+    }
+
+    switch (method) {
+        case ConvolutionMethod::Direct:
+            convolveDirect(signal, signal_size, kernel, kernel_size, out);
+            break;
+        case ConvolutionMethod::FFT:
+            convolveOverlapAdd(signal, signal_size, kernel, kernel_size, out, singleBlockSize(signal_size, kernel_size), plans);
+            break;
+        case ConvolutionMethod::OverlapAdd:
+        case ConvolutionMethod::Auto:
+            convolveOverlapAdd(signal, signal_size, kernel, kernel_size, out, bestBlockSize(signal_size, kernel_size), plans);
+            break;
+    }
+}
+
+void convolve(const double* signal, size_t signal_size, const double* kernel, size_t kernel_size,
+              double* out, ConvolutionMethod method, RealFFTPlanCache& plans) {
+    convolveWith(signal, signal_size, kernel, kernel_size, out, method, plans);
+}
+
+void convolve(const float* signal, size_t signal_size, const float* kernel, size_t kernel_size,
+              float* out, ConvolutionMethod method, FloatRealFFTPlanCache& plans) {
+    convolveWith(signal, signal_size, kernel, kernel_size, out, method, plans);
+}
+
+} // namespace margelo::nitro::rnmath::dsp
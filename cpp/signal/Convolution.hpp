@@ -0,0 +1,25 @@
+#pragma once
+
+#include "FFT.hpp"
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::dsp {
+
+enum class ConvolutionMethod {
+    Auto,       // Cheapest of the below for the given sizes
+    Direct,     // O(N*M) multiply-accumulate
+    FFT,        // One zero-padded transform over the whole signal
+    OverlapAdd, // Block-wise FFT convolution with a fixed kernel spectrum
+};
+
+// Full linear convolution of `signal` (N samples) with `kernel` (M taps) into
+// `out` (N + M - 1 samples). `out` must not alias the inputs.
+void convolve(const double* signal, size_t signal_size, const double* kernel, size_t kernel_size,
+              double* out, ConvolutionMethod method, RealFFTPlanCache& plans);
+void convolve(const float* signal, size_t signal_size, const float* kernel, size_t kernel_size,
+              float* out, ConvolutionMethod method, FloatRealFFTPlanCache& plans);
+
+// Resolves `Auto` to a concrete method using an operation-count model
+ConvolutionMethod chooseConvolutionMethod(size_t signal_size, size_t kernel_size);
+
+} // namespace margelo::nitro::rnmath::dsp
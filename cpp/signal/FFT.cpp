@@ -0,0 +1,305 @@
+#include "FFT.hpp"
+#include <cmath>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace margelo::nitro::rnmath::dsp {
+
+
+template <typename T>
+BasicFFTPlan<T>::BasicFFTPlan(size_t size, FFTDirection direction)
+    : _size(size), _direction(direction), _bluestein(size > 1 && !isPowerOfTwo(size)) {
+    // Bluestein needs a linear convolution of length 2N - 1 without wrap-around
+    _m = _bluestein ? nextPowerOfTwo(2 * size - 1) : std::max<size_t>(size, 1);
+
+    size_t bits = 0;
+    while ((size_t(1) << bits) < _m) bits++;
+    _bitReverse.resize(_m);
+    for (size_t i = 0; i < _m; i++) {
+        uint32_t r = 0;
+        for (size_t b = 0; b < bits; b++) {
+            r |= ((i >> b) & 1u) << (bits - 1 - b);
+        }
+        _bitReverse[i] = r;
+    }
+
+    // The radix-2 core runs in the plan's direction, except under Bluestein
+    // where it is always forward and the chirp carries the direction instead
+    double sign = (_direction == FFTDirection::Inverse && !_bluestein) ? 1.0 : -1.0;
+    size_t half_m = _m / 2;
+    std::vector<double> base_cos(half_m), base_sin(half_m);
+    for (size_t k = 0; k < half_m; k++) {
+        double angle = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(_m);
+        base_cos[k] = std::cos(angle);
+        base_sin[k] = sign * std::sin(angle);
+    }
+
+    _twiddleReal.resize(_m > 1 ? _m - 1 : 0);
+    _twiddleImag.resize(_twiddleReal.size());
+    for (size_t half = 1; half < _m; half <<= 1) {
+        size_t step = _m / (2 * half);
+        for (size_t j = 0; j < half; j++) {
+            _twiddleReal[half - 1 + j] = static_cast<T>(base_cos[j * step]);
+            _twiddleImag[half - 1 + j] = static_cast<T>(base_sin[j * step]);
+        }
+    }
+
+    if (!_bluestein) return;
+
+    _scratchReal.resize(_m);
+    _scratchImag.resize(_m);
+
+    // Chirp c[n] = exp(-+i*pi*n^2/N); n^2 is reduced mod 2N to keep the angle exact
+    double chirp_sign = (_direction == FFTDirection::Inverse) ? 1.0 : -1.0;
+    _chirpReal.resize(_size);
+    _chirpImag.resize(_size);
+    for (size_t n = 0; n < _size; n++) {
+        uint64_t n2 = (static_cast<uint64_t>(n) * n) % (2 * static_cast<uint64_t>(_size));
+        double angle = M_PI * static_cast<double>(n2) / static_cast<double>(_size);
+        _chirpReal[n] = static_cast<T>(std::cos(angle));
+        _chirpImag[n] = static_cast<T>(chirp_sign * std::sin(angle));
+    }
+
+    _kernelReal.assign(_m, T(0));
+    _kernelImag.assign(_m, T(0));
+    for (size_t n = 0; n < _size; n++) {
+        _kernelReal[n] = _chirpReal[n];
+        _kernelImag[n] = -_chirpImag[n];
+        if (n > 0) {
+            _kernelReal[_m - n] = _chirpReal[n];
+            _kernelImag[_m - n] = -_chirpImag[n];
+        }
+    }
+    radix2(_kernelReal.data(), _kernelImag.data());
+}
+
+template <typename T>
+size_t BasicFFTPlan<T>::memorySize() const {
+    size_t Ts = _twiddleReal.size() + _twiddleImag.size()
+                   + _chirpReal.size() + _chirpImag.size()
+                   + _kernelReal.size() + _kernelImag.size()
+                   + _scratchReal.size() + _scratchImag.size();
+    return Ts * sizeof(T) + _bitReverse.size() * sizeof(uint32_t);
+}
+
+template <typename T>
+void BasicFFTPlan<T>::radix2(T* real, T* imag) const {
+    for (size_t i = 0; i < _m; i++) {
+        size_t j = _bitReverse[i];
+        if (i < j) {
+            std::swap(real[i], real[j]);
+            std::swap(imag[i], imag[j]);
+        }
+    }
+
+    for (size_t half = 1; half < _m; half <<= 1) {
+        const T* wr = _twiddleReal.data() + half - 1;
+        const T* wi = _twiddleImag.data() + half - 1;
+
+        for (size_t start = 0; start < _m; start += 2 * half) {
+            T* r0 = real + start;
+            T* i0 = imag + start;
+            T* r1 = r0 + half;
+            T* i1 = i0 + half;
+
+            for (size_t j = 0; j < half; j++) {
+                T tr = r1[j] * wr[j] - i1[j] * wi[j];
+                T ti = r1[j] * wi[j] + i1[j] * wr[j];
+                r1[j] = r0[j] - tr;
+                i1[j] = i0[j] - ti;
+                r0[j] += tr;
+                i0[j] += ti;
+            }
+        }
+    }
+}
+
+template <typename T>
+void BasicFFTPlan<T>::radix2Inverse(T* real, T* imag) const {
+    // Unnormalized transform with the opposite sign, via conj(FFT(conj(x)))
+    for (size_t i = 0; i < _m; i++) imag[i] = -imag[i];
+    radix2(real, imag);
+    for (size_t i = 0; i < _m; i++) imag[i] = -imag[i];
+}
+
+template <typename T>
+void BasicFFTPlan<T>::execute(const T* in_real, const T* in_imag, T* out_real, T* out_imag) const {
+    if (_size == 0) return;
+
+    T scale = (_direction == FFTDirection::Inverse) ? T(1) / static_cast<T>(_size) : T(1);
+
+    if (!_bluestein) {
+        if (out_real != in_real) std::copy_n(in_real, _size, out_real);
+        if (out_imag != in_imag) std::copy_n(in_imag, _size, out_imag);
+        radix2(out_real, out_imag);
+
+        if (scale != T(1)) {
+            for (size_t i = 0; i < _size; i++) {
+                out_real[i] *= scale;
+                out_imag[i] *= scale;
+            }
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_scratchMutex);
+    T* work_real = _scratchReal.data();
+    T* work_imag = _scratchImag.data();
+    std::fill(work_real + _size, work_real + _m, T(0));
+    std::fill(work_imag + _size, work_imag + _m, T(0));
+
+    for (size_t n = 0; n < _size; n++) {
+        T xr = in_real[n], xi = in_imag[n];
+        work_real[n] = xr * _chirpReal[n] - xi * _chirpImag[n];
+        work_imag[n] = xr * _chirpImag[n] + xi * _chirpReal[n];
+    }
+
+    radix2(work_real, work_imag);
+    for (size_t k = 0; k < _m; k++) {
+        T ar = work_real[k], ai = work_imag[k];
+        work_real[k] = ar * _kernelReal[k] - ai * _kernelImag[k];
+        work_imag[k] = ar * _kernelImag[k] + ai * _kernelReal[k];
+    }
+    radix2Inverse(work_real, work_imag);
+
+    // Normalize the length-m inverse transform and apply the output chirp
+    scale /= static_cast<T>(_m);
+    for (size_t k = 0; k < _size; k++) {
+        T yr = work_real[k], yi = work_imag[k];
+        out_real[k] = (yr * _chirpReal[k] - yi * _chirpImag[k]) * scale;
+        out_imag[k] = (yr * _chirpImag[k] + yi * _chirpReal[k]) * scale;
+    }
+}
+
+
+template <typename T>
+BasicRealFFTPlan<T>::BasicRealFFTPlan(size_t size, FFTDirection direction)
+    : _size(size), _direction(direction), _packed(size >= 2 && size % 2 == 0) {
+    if (!_packed) {
+        _complex = std::make_unique<BasicFFTPlan<T>>(_size, _direction);
+        _scratchReal.resize(_size);
+        _scratchImag.resize(_size);
+        return;
+    }
+
+    size_t half = _size / 2;
+    _complex = std::make_unique<BasicFFTPlan<T>>(half, _direction);
+    _scratchReal.resize(half);
+    _scratchImag.resize(half);
+
+    _cos.resize(half + 1);
+    _sin.resize(half + 1);
+    for (size_t k = 0; k <= half; k++) {
+        double angle = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(_size);
+        _cos[k] = static_cast<T>(std::cos(angle));
+        _sin[k] = static_cast<T>(std::sin(angle));
+    }
+}
+
+template <typename T>
+size_t BasicRealFFTPlan<T>::memorySize() const {
+    size_t Ts = _cos.size() + _sin.size() + _scratchReal.size() + _scratchImag.size();
+    return Ts * sizeof(T) + _complex->memorySize();
+}
+
+template <typename T>
+void BasicRealFFTPlan<T>::forward(const T* in, T* out_real, T* out_imag) const {
+    if (_size == 0) return;
+
+    std::lock_guard<std::mutex> lock(_scratchMutex);
+    T* zr = _scratchReal.data();
+    T* zi = _scratchImag.data();
+
+    if (!_packed) {
+        std::copy_n(in, _size, zr);
+        std::fill_n(zi, _size, T(0));
+        _complex->execute(zr, zi, zr, zi);
+        std::copy_n(zr, bins(), out_real);
+        std::copy_n(zi, bins(), out_imag);
+        return;
+    }
+
+    size_t half = _size / 2;
+    for (size_t n = 0; n < half; n++) {
+        zr[n] = in[2 * n];
+        zi[n] = in[2 * n + 1];
+    }
+    _complex->execute(zr, zi, zr, zi);
+
+    // X[k] = E[k] + W^k * O[k], with E/O the spectra of the even/odd samples
+    // recovered from Z[k] and conj(Z[half - k])
+    for (size_t k = 0; k <= half; k++) {
+        size_t a = (k == half) ? 0 : k;
+        size_t b = (half - k) % half;
+        T er = T(0.5) * (zr[a] + zr[b]);
+        T ei = T(0.5) * (zi[a] - zi[b]);
+        T or_ = T(0.5) * (zi[a] + zi[b]);
+        T oi = -T(0.5) * (zr[a] - zr[b]);
+
+        T c = _cos[k], s = -_sin[k];
+        out_real[k] = er + c * or_ - s * oi;
+        out_imag[k] = ei + c * oi + s * or_;
+    }
+}
+
+template <typename T>
+void BasicRealFFTPlan<T>::inverse(const T* in_real, const T* in_imag, T* out) const {
+    if (_size == 0) return;
+
+    std::lock_guard<std::mutex> lock(_scratchMutex);
+    T* zr = _scratchReal.data();
+    T* zi = _scratchImag.data();
+    size_t nyquist = _size / 2;
+
+    auto imag_at = [&](size_t k) {
+        return (k == 0 || (k == nyquist && _size % 2 == 0)) ? T(0) : in_imag[k];
+    };
+
+    if (!_packed) {
+        // Rebuild the full Hermitian spectrum and run a complex inverse
+        for (size_t k = 0; k < bins(); k++) {
+            zr[k] = in_real[k];
+            zi[k] = imag_at(k);
+        }
+        for (size_t k = bins(); k < _size; k++) {
+            zr[k] = in_real[_size - k];
+            zi[k] = -imag_at(_size - k);
+        }
+        _complex->execute(zr, zi, zr, zi);
+        std::copy_n(zr, _size, out);
+        return;
+    }
+
+    size_t half = nyquist;
+    for (size_t k = 0; k < half; k++) {
+        T xr = in_real[k], xi = imag_at(k);
+        T cr = in_real[half - k], ci = -imag_at(half - k);
+
+        T er = T(0.5) * (xr + cr), ei = T(0.5) * (xi + ci);
+        T dr = T(0.5) * (xr - cr), di = T(0.5) * (xi - ci);
+        // O[k] = D[k] * conj(W^k)
+        T c = _cos[k], s = _sin[k];
+        T or_ = dr * c - di * s;
+        T oi = dr * s + di * c;
+
+        // Z[k] = E[k] + i * O[k]
+        zr[k] = er - oi;
+        zi[k] = ei + or_;
+    }
+    _complex->execute(zr, zi, zr, zi);
+
+    for (size_t n = 0; n < half; n++) {
+        out[2 * n] = zr[n];
+        out[2 * n + 1] = zi[n];
+    }
+}
+
+template class BasicFFTPlan<double>;
+template class BasicFFTPlan<float>;
+template class BasicRealFFTPlan<double>;
+template class BasicRealFFTPlan<float>;
+
+} // namespace margelo::nitro::rnmath::dsp
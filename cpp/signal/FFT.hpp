@@ -0,0 +1,182 @@
+#pragma once
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::rnmath::dsp {
+
+enum class FFTDirection {
+    Forward, // X[k] = sum x[n] * exp(-2*pi*i*k*n/N)
+    Inverse, // x[n] = 1/N * sum X[k] * exp(+2*pi*i*k*n/N)
+};
+
+// Precomputed complex FFT of a fixed size and direction over split real/imag arrays.
+// Power-of-two sizes run an iterative radix-2 transform. Other sizes use Bluestein's
+// chirp-z algorithm on a zero-padded power-of-two transform, so every size is O(N log N).
+// All trigonometric tables and scratch buffers are allocated once, in the constructor,
+// so a plan can be executed repeatedly without further allocation.
+// `T` is the sample type (double or float); tables are computed in double
+// and rounded once, so a float plan only loses precision in the butterflies.
+template <typename T>
+class BasicFFTPlan {
+public:
+    BasicFFTPlan(size_t size, FFTDirection direction);
+
+    size_t size() const { return _size; }
+    FFTDirection direction() const { return _direction; }
+
+    // Approximate heap footprint of the tables and scratch buffers, in bytes
+    size_t memorySize() const;
+
+    // Transforms `size()` complex values. Outputs may alias the inputs.
+    // Safe to call concurrently; Bluestein plans serialize on their scratch buffers.
+    void execute(const T* in_real, const T* in_imag, T* out_real, T* out_imag) const;
+
+private:
+    size_t _size;
+    FFTDirection _direction;
+
+    // Radix-2 core of size `_m`: `_size` itself, or the Bluestein padding size
+    size_t _m;
+    std::vector<uint32_t> _bitReverse;
+    // Per-stage twiddles laid out contiguously: the stage with half-length h
+    // stores exp(sign*i*pi*j/h) for j < h at offset h - 1
+    std::vector<T> _twiddleReal;
+    std::vector<T> _twiddleImag;
+
+    // Bluestein tables, only used when `_size` is not a power of two
+    bool _bluestein;
+    std::vector<T> _chirpReal;
+    std::vector<T> _chirpImag;
+    std::vector<T> _kernelReal; // FFT of the conjugated, wrapped chirp
+    std::vector<T> _kernelImag;
+    mutable std::mutex _scratchMutex;
+    mutable std::vector<T> _scratchReal;
+    mutable std::vector<T> _scratchImag;
+
+    void radix2(T* real, T* imag) const;
+    void radix2Inverse(T* real, T* imag) const;
+};
+
+// FFT of real-valued signals, returning/consuming only the N/2 + 1 non-redundant bins.
+// Even sizes pack the signal into an N/2-point complex transform (even samples as the
+// real part, odd samples as the imaginary part) and untangle the halves afterwards,
+// which halves the work. Odd sizes fall back to a full complex transform.
+template <typename T>
+class BasicRealFFTPlan {
+public:
+    BasicRealFFTPlan(size_t size, FFTDirection direction);
+
+    size_t size() const { return _size; }
+    size_t bins() const { return _size / 2 + 1; }
+    FFTDirection direction() const { return _direction; }
+
+    size_t memorySize() const;
+
+    // Forward plans: `size()` real samples -> `bins()` complex values
+    void forward(const T* in, T* out_real, T* out_imag) const;
+    // Inverse plans: `bins()` complex values -> `size()` real samples, normalized by 1/N.
+    // The imaginary parts of the DC and Nyquist bins are ignored.
+    void inverse(const T* in_real, const T* in_imag, T* out) const;
+
+private:
+    size_t _size;
+    FFTDirection _direction;
+    bool _packed;
+    std::unique_ptr<BasicFFTPlan<T>> _complex;
+    // cos/sin(2*pi*k/N) for k <= N/2, used to untangle the packed transform
+    std::vector<T> _cos;
+    std::vector<T> _sin;
+    mutable std::mutex _scratchMutex;
+    mutable std::vector<T> _scratchReal;
+    mutable std::vector<T> _scratchImag;
+};
+
+// Instantiated for double and float in FFT.cpp
+extern template class BasicFFTPlan<double>;
+extern template class BasicFFTPlan<float>;
+extern template class BasicRealFFTPlan<double>;
+extern template class BasicRealFFTPlan<float>;
+
+using FFTPlan = BasicFFTPlan<double>;
+using RealFFTPlan = BasicRealFFTPlan<double>;
+using FloatFFTPlan = BasicFFTPlan<float>;
+using FloatRealFFTPlan = BasicRealFFTPlan<float>;
+
+// Thread-safe LRU cache of plans keyed by size and direction.
+// Evicted plans stay alive for as long as a caller still holds them.
+template <typename Plan>
+class PlanCache {
+public:
+    explicit PlanCache(size_t capacity = DEFAULT_CAPACITY) : _capacity(capacity) { }
+
+    std::shared_ptr<const Plan> get(size_t size, FFTDirection direction) {
+        Key key = (static_cast<Key>(size) << 1) | (direction == FFTDirection::Inverse ? 1u : 0u);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (auto plan = lookup(key)) return plan;
+        }
+
+        // Build outside the lock; a concurrent miss on the same key just builds twice
+        auto plan = std::make_shared<const Plan>(size, direction);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (auto existing = lookup(key)) return existing;
+
+        _entries.emplace_front(key, plan);
+        _index[key] = _entries.begin();
+        while (_entries.size() > _capacity) {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+        return plan;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.clear();
+        _index.clear();
+    }
+
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+
+private:
+    using Key = uint64_t;
+    using Entry = std::pair<Key, std::shared_ptr<const Plan>>;
+
+    size_t _capacity;
+    std::mutex _mutex;
+    std::list<Entry> _entries; // most recently used first
+    std::unordered_map<Key, typename std::list<Entry>::iterator> _index;
+
+    // Must be called with `_mutex` held
+    std::shared_ptr<const Plan> lookup(Key key) {
+        auto it = _index.find(key);
+        if (it == _index.end()) return nullptr;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->second;
+    }
+};
+
+using FFTPlanCache = PlanCache<FFTPlan>;
+using RealFFTPlanCache = PlanCache<RealFFTPlan>;
+using FloatFFTPlanCache = PlanCache<FloatFFTPlan>;
+using FloatRealFFTPlanCache = PlanCache<FloatRealFFTPlan>;
+
+inline bool isPowerOfTwo(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+inline size_t nextPowerOfTwo(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+} // namespace margelo::nitro::rnmath::dsp
@@ -0,0 +1,104 @@
+#include "Filter.hpp"
+#include "Convolution.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+namespace margelo::nitro::rnmath::dsp {
+
+
+FIRFilter::FIRFilter(const std::vector<double>& taps) : _taps(taps), _reversed(taps.rbegin(), taps.rend()) {
+    if (_taps.empty()) {
+        throw std::runtime_error("FIR filter needs at least one tap");
+    }
+    _work.assign(_taps.size() - 1, 0.0);
+}
+
+void FIRFilter::process(const double* in, double* out, size_t count) {
+    if (count == 0) return;
+
+    size_t M = _taps.size();
+    size_t history = M - 1;
+    // Copying the chunk behind the history also makes in-place calls safe
+    _work.resize(history + count);
+    std::copy_n(in, count, _work.begin() + history);
+
+    if (chooseConvolutionMethod(count, M) == ConvolutionMethod::Direct) {
+        // y[i] = sum_k h[M-1-k] * work[i+k], a contiguous dot product per output
+        const double* h = _reversed.data();
+        for (size_t i = 0; i < count; i++) {
+            const double* x = _work.data() + i;
+            double sum = 0.0;
+            for (size_t k = 0; k < M; k++) {
+                sum += h[k] * x[k];
+            }
+            out[i] = sum;
+        }
+    } else {
+        // Only the outputs whose window lies fully inside history + chunk are valid
+        _scratch.resize(_work.size() + M - 1);
+        convolve(_work.data(), _work.size(), _taps.data(), M, _scratch.data(), ConvolutionMethod::Auto, _plans);
+        std::copy_n(_scratch.begin() + history, count, out);
+    }
+
+    // Keep the last M - 1 inputs for the next chunk
+    std::copy(_work.end() - history, _work.end(), _work.begin());
+    _work.resize(history);
+}
+
+void FIRFilter::reset() {
+    std::fill(_work.begin(), _work.end(), 0.0);
+}
+
+size_t FIRFilter::memorySize() const {
+    size_t doubles = _taps.capacity() + _reversed.capacity() + _work.capacity() + _scratch.capacity();
+    return doubles * sizeof(double);
+}
+
+
+BiquadFilter::BiquadFilter(const std::vector<Coefficients>& sections) {
+    if (sections.empty()) {
+        throw std::runtime_error("Biquad filter needs at least one section");
+    }
+
+    _sections.reserve(sections.size());
+    for (const auto& c : sections) {
+        double a0 = c[3];
+        if (a0 == 0.0) {
+            throw std::runtime_error("Biquad section has a0 = 0");
+        }
+        _sections.push_back(Section{c[0] / a0, c[1] / a0, c[2] / a0, c[4] / a0, c[5] / a0});
+    }
+}
+
+void BiquadFilter::process(const double* in, double* out, size_t count) {
+    if (count == 0) return;
+
+    // Run each section over the whole chunk; later sections read `out` in place
+    const double* src = in;
+    for (auto& s : _sections) {
+        double z1 = s.z1, z2 = s.z2;
+        for (size_t i = 0; i < count; i++) {
+            double x = src[i];
+            double y = s.b0 * x + z1;
+            z1 = s.b1 * x - s.a1 * y + z2;
+            z2 = s.b2 * x - s.a2 * y;
+            out[i] = y;
+        }
+        s.z1 = z1;
+        s.z2 = z2;
+        src = out;
+    }
+}
+
+void BiquadFilter::reset() {
+    for (auto& s : _sections) {
+        s.z1 = 0.0;
+        s.z2 = 0.0;
+    }
+}
+
+size_t BiquadFilter::memorySize() const {
+    return _sections.capacity() * sizeof(Section);
+}
+
+} // namespace margelo::nitro::rnmath::dsp
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "FFT.hpp"
+#include <vector>
+#include <array>
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::dsp {
+
+// Causal filter that carries its state across calls, so a stream can be
+// processed in arbitrary chunks with the same result as one long call
+class StreamingFilter {
+public:
+    virtual ~StreamingFilter() = default;
+
+    // Filters `count` samples. `out` may alias `in` exactly.
+    virtual void process(const double* in, double* out, size_t count) = 0;
+    // Clears the delay line back to silence
+    virtual void reset() = 0;
+    virtual size_t memorySize() const = 0;
+};
+
+// y[n] = sum_k h[k] * x[n - k]. The last M - 1 inputs are kept in front of
+// the next chunk, so each chunk only costs its own length times M. Long
+// chunks through long filters go through FFT convolution instead.
+class FIRFilter : public StreamingFilter {
+public:
+    explicit FIRFilter(const std::vector<double>& taps);
+
+    void process(const double* in, double* out, size_t count) override;
+    void reset() override;
+    size_t memorySize() const override;
+
+private:
+    std::vector<double> _taps;
+    std::vector<double> _reversed;
+    // M - 1 samples of history followed by the current chunk
+    std::vector<double> _work;
+    // Full convolution output of the FFT path
+    std::vector<double> _scratch;
+    RealFFTPlanCache _plans{4};
+};
+
+// Cascade of second-order sections in transposed direct form II.
+// Each section is {b0, b1, b2, a0, a1, a2}, normalized by a0 on construction.
+class BiquadFilter : public StreamingFilter {
+public:
+    using Coefficients = std::array<double, 6>;
+
+    explicit BiquadFilter(const std::vector<Coefficients>& sections);
+
+    void process(const double* in, double* out, size_t count) override;
+    void reset() override;
+    size_t memorySize() const override;
+
+private:
+    struct Section {
+        double b0, b1, b2, a1, a2;
+        double z1 = 0.0, z2 = 0.0;
+    };
+    std::vector<Section> _sections;
+};
+
+} // namespace margelo::nitro::rnmath::dsp
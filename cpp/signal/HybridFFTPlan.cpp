@@ -0,0 +1,75 @@
+#include "HybridFFTPlan.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+HybridFFTPlan::HybridFFTPlan(std::shared_ptr<const dsp::FFTPlan> plan) : HybridObject(TAG), _plan(std::move(plan)) { }
+
+
+double HybridFFTPlan::getSize() {
+    return static_cast<double>(_plan->size());
+}
+
+bool HybridFFTPlan::getInverse() {
+    return _plan->direction() == dsp::FFTDirection::Inverse;
+}
+
+std::tuple<std::vector<double>, std::vector<double>> HybridFFTPlan::execute(const std::vector<double>& real, const std::vector<double>& imag) {
+    return run(*_plan, real, imag);
+}
+
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridFFTPlan::executeBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    return runBuffer(*_plan, real, imag, outReal, outImag);
+}
+
+size_t HybridFFTPlan::getExternalMemorySize() noexcept {
+    return _plan->memorySize();
+}
+
+std::tuple<std::vector<double>, std::vector<double>> HybridFFTPlan::run(const dsp::FFTPlan& plan, const std::vector<double>& real, const std::vector<double>& imag) {
+    size_t N = real.size();
+    if (N != imag.size()) {
+        throw std::runtime_error("Real and imaginary parts must have same size");
+    }
+    if (N != plan.size()) {
+        throw std::runtime_error("Input size " + std::to_string(N) + " does not match FFT plan size " + std::to_string(plan.size()));
+    }
+
+    std::vector<double> result_real(N);
+    std::vector<double> result_imag(N);
+    plan.execute(real.data(), imag.data(), result_real.data(), result_imag.data());
+    return std::make_tuple(std::move(result_real), std::move(result_imag));
+}
+
+template <typename T>
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridFFTPlan::runBuffer(const dsp::BasicFFTPlan<T>& plan, const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    TypedBuffer<T> re = asTyped<T>(real, "real");
+    TypedBuffer<T> im = asTyped<T>(imag, "imag");
+    size_t N = re.size;
+    if (N != im.size) {
+        throw std::runtime_error("Real and imaginary parts must have same size");
+    }
+    if (N != plan.size()) {
+        throw std::runtime_error("Input size " + std::to_string(N) + " does not match FFT plan size " + std::to_string(plan.size()));
+    }
+
+    auto result_real = outputTyped<T>(outReal, N);
+    auto result_imag = outputTyped<T>(outImag, N);
+    TypedBuffer<T> out_re = asTyped<T>(result_real, "outReal");
+    TypedBuffer<T> out_im = asTyped<T>(result_imag, "outImag");
+    // The plan itself is alias-safe, but a partial overlap would corrupt the input mid-transform
+    if (overlaps(out_re, out_im) || (overlaps(out_re, re) && out_re.data != re.data) || (overlaps(out_im, im) && out_im.data != im.data)
+        || overlaps(out_re, im) || overlaps(out_im, re)) {
+        throw std::runtime_error("Output buffers must not partially overlap the inputs or each other");
+    }
+
+    plan.execute(re.data, im.data, out_re.data, out_im.data);
+    return std::make_tuple(result_real, result_imag);
+}
+
+template std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridFFTPlan::runBuffer<double>(const dsp::FFTPlan&, const std::shared_ptr<ArrayBuffer>&, const std::shared_ptr<ArrayBuffer>&, const std::optional<std::shared_ptr<ArrayBuffer>>&, const std::optional<std::shared_ptr<ArrayBuffer>>&);
+template std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridFFTPlan::runBuffer<float>(const dsp::FloatFFTPlan&, const std::shared_ptr<ArrayBuffer>&, const std::shared_ptr<ArrayBuffer>&, const std::optional<std::shared_ptr<ArrayBuffer>>&, const std::optional<std::shared_ptr<ArrayBuffer>>&);
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "HybridFFTPlanSpec.hpp"
+#include "FFT.hpp"
+#include <vector>
+#include <tuple>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a (possibly cached) native FFT plan
+class HybridFFTPlan : public HybridFFTPlanSpec {
+public:
+    explicit HybridFFTPlan(std::shared_ptr<const dsp::FFTPlan> plan);
+
+    double getSize() override;
+    bool getInverse() override;
+
+    std::tuple<std::vector<double>, std::vector<double>> execute(const std::vector<double>& real, const std::vector<double>& imag) override;
+    std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> executeBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+    // Shared with HybridMath::fft/fftBuffer/fftBufferF32, which run plans taken from the caches
+    static std::tuple<std::vector<double>, std::vector<double>> run(const dsp::FFTPlan& plan, const std::vector<double>& real, const std::vector<double>& imag);
+    template <typename T>
+    static std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> runBuffer(const dsp::BasicFFTPlan<T>& plan, const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag);
+
+private:
+    std::shared_ptr<const dsp::FFTPlan> _plan;
+};
+
+} // namespace margelo::nitro::rnmath
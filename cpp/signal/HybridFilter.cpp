@@ -0,0 +1,37 @@
+#include "HybridFilter.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+
+namespace margelo::nitro::rnmath {
+
+HybridFilter::HybridFilter(std::unique_ptr<dsp::StreamingFilter> filter) : HybridObject(TAG), _filter(std::move(filter)) { }
+
+
+std::vector<double> HybridFilter::process(const std::vector<double>& chunk) {
+    std::vector<double> result(chunk.size());
+    _filter->process(chunk.data(), result.data(), chunk.size());
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridFilter::processBuffer(const std::shared_ptr<ArrayBuffer>& chunk, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    Float64Buffer x = asFloat64(chunk, "chunk");
+
+    auto result = outputFloat64(out, x.size);
+    Float64Buffer y = asFloat64(result, "out");
+    if (overlaps(y, x) && y.data != x.data) {
+        throw std::runtime_error("Output buffer must not partially overlap the input");
+    }
+
+    _filter->process(x.data, y.data, x.size);
+    return result;
+}
+
+void HybridFilter::reset() {
+    _filter->reset();
+}
+
+size_t HybridFilter::getExternalMemorySize() noexcept {
+    return _filter->memorySize();
+}
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "HybridFilterSpec.hpp"
+#include "Filter.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a native streaming filter and its delay line
+class HybridFilter : public HybridFilterSpec {
+public:
+    explicit HybridFilter(std::unique_ptr<dsp::StreamingFilter> filter);
+
+    std::vector<double> process(const std::vector<double>& chunk) override;
+    std::shared_ptr<ArrayBuffer> processBuffer(const std::shared_ptr<ArrayBuffer>& chunk, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    void reset() override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    std::unique_ptr<dsp::StreamingFilter> _filter;
+};
+
+} // namespace margelo::nitro::rnmath
@@ -1,62 +1,224 @@
 #include "HybridMath.hpp"
+#include "FFT.hpp"
+#include "Convolution.hpp"
+#include "HybridFFTPlan.hpp"
+#include "Filter.hpp"
+#include "HybridFilter.hpp"
+#include "../utils/BufferUtils.hpp"
 #include <stdexcept>
 #include <vector>
 #include <tuple>
 #include <cmath>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+#include <algorithm>
+#include <string>
 
 namespace margelo::nitro::rnmath {
 
+static dsp::ConvolutionMethod toConvolutionMethod(std::optional<ConvolutionMode> mode) {
+    switch (mode.value_or(ConvolutionMode::AUTO)) {
+        case ConvolutionMode::DIRECT: return dsp::ConvolutionMethod::Direct;
+        case ConvolutionMode::FFT: return dsp::ConvolutionMethod::FFT;
+        case ConvolutionMode::OVERLAPADD: return dsp::ConvolutionMethod::OverlapAdd;
+        default: return dsp::ConvolutionMethod::Auto;
+    }
+}
 
-std::tuple<std::vector<double>, std::vector<double>> HybridMath::fft(const std::vector<double>& real, const std::vector<double>& imag) {
-    // Simple DFT implementation (not optimized FFT)
-    size_t N = real.size();
-    if (N != imag.size()) {
+// Output length of an inverse real FFT over `bins` half-spectrum values
+static size_t irfftSize(size_t real_size, size_t imag_size, std::optional<double> size) {
+    if (real_size != imag_size) {
         throw std::runtime_error("Real and imaginary parts must have same size");
     }
-    
-    std::vector<double> result_real(N);
-    std::vector<double> result_imag(N);
-    
-    for (size_t k = 0; k < N; k++) {
-        double real_sum = 0.0;
-        double imag_sum = 0.0;
-        
-        for (size_t n = 0; n < N; n++) {
-            double angle = -2.0 * M_PI * k * n / N;
-            double cos_val = std::cos(angle);
-            double sin_val = std::sin(angle);
-            
-            real_sum += real[n] * cos_val - imag[n] * sin_val;
-            imag_sum += real[n] * sin_val + imag[n] * cos_val;
-        }
-        
-        result_real[k] = real_sum;
-        result_imag[k] = imag_sum;
+    if (real_size == 0) {
+        throw std::runtime_error("Half spectrum must not be empty");
+    }
+
+    size_t N = size.has_value() ? toSize(size.value(), "size") : 2 * (real_size - 1);
+    if (N == 0 || N / 2 + 1 != real_size) {
+        throw std::runtime_error("Half spectrum of " + std::to_string(real_size) + " bins does not match output size " + std::to_string(N));
+    }
+    return N;
+}
+
+// Buffer transforms shared by the float64 and float32 entry points, each
+// running plans from the cache of its own precision
+template <typename T>
+static std::shared_ptr<ArrayBuffer> convolveBufferWith(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode, dsp::PlanCache<dsp::BasicRealFFTPlan<T>>& plans) {
+    TypedBuffer<T> x = asTyped<T>(signal, "signal");
+    TypedBuffer<T> h = asTyped<T>(kernel, "kernel");
+    if (x.size == 0 || h.size == 0) {
+        return outputTyped<T>(out, 0);
     }
-    
+
+    auto result = outputTyped<T>(out, x.size + h.size - 1);
+    TypedBuffer<T> y = asTyped<T>(result, "out");
+    if (overlaps(y, x) || overlaps(y, h)) {
+        throw std::runtime_error("Output buffer must not overlap the inputs");
+    }
+
+    dsp::convolve(x.data, x.size, h.data, h.size, y.data, toConvolutionMethod(mode), plans);
+    return result;
+}
+
+template <typename T>
+static std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> rfftBufferWith(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag, dsp::PlanCache<dsp::BasicRealFFTPlan<T>>& plans) {
+    TypedBuffer<T> x = asTyped<T>(signal, "signal");
+    auto plan = plans.get(x.size, dsp::FFTDirection::Forward);
+
+    auto result_real = outputTyped<T>(outReal, plan->bins());
+    auto result_imag = outputTyped<T>(outImag, plan->bins());
+    TypedBuffer<T> out_re = asTyped<T>(result_real, "outReal");
+    TypedBuffer<T> out_im = asTyped<T>(result_imag, "outImag");
+    if (overlaps(out_re, x) || overlaps(out_im, x) || overlaps(out_re, out_im)) {
+        throw std::runtime_error("Output buffers must not overlap the input or each other");
+    }
+
+    plan->forward(x.data, out_re.data, out_im.data);
     return std::make_tuple(result_real, result_imag);
 }
 
-std::vector<double> HybridMath::convolve(const std::vector<double>& signal, const std::vector<double>& kernel) {
+template <typename T>
+static std::shared_ptr<ArrayBuffer> irfftBufferWith(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out, dsp::PlanCache<dsp::BasicRealFFTPlan<T>>& plans) {
+    TypedBuffer<T> re = asTyped<T>(real, "real");
+    TypedBuffer<T> im = asTyped<T>(imag, "imag");
+    size_t N = irfftSize(re.size, im.size, size);
+    auto plan = plans.get(N, dsp::FFTDirection::Inverse);
+
+    auto result = outputTyped<T>(out, N);
+    TypedBuffer<T> y = asTyped<T>(result, "out");
+    if (overlaps(y, re) || overlaps(y, im)) {
+        throw std::runtime_error("Output buffer must not overlap the inputs");
+    }
+
+    plan->inverse(re.data, im.data, y.data);
+    return result;
+}
+
+
+std::tuple<std::vector<double>, std::vector<double>> HybridMath::fft(const std::vector<double>& real, const std::vector<double>& imag) {
+    return HybridFFTPlan::run(*_fftPlans.get(real.size(), dsp::FFTDirection::Forward), real, imag);
+}
+
+std::tuple<std::vector<double>, std::vector<double>> HybridMath::ifft(const std::vector<double>& real, const std::vector<double>& imag) {
+    return HybridFFTPlan::run(*_fftPlans.get(real.size(), dsp::FFTDirection::Inverse), real, imag);
+}
+
+std::tuple<std::vector<double>, std::vector<double>> HybridMath::rfft(const std::vector<double>& signal) {
+    auto plan = _realFftPlans.get(signal.size(), dsp::FFTDirection::Forward);
+
+    std::vector<double> result_real(plan->bins());
+    std::vector<double> result_imag(plan->bins());
+    plan->forward(signal.data(), result_real.data(), result_imag.data());
+    return std::make_tuple(std::move(result_real), std::move(result_imag));
+}
+
+std::vector<double> HybridMath::irfft(const std::vector<double>& real, const std::vector<double>& imag, std::optional<double> size) {
+    size_t N = irfftSize(real.size(), imag.size(), size);
+    auto plan = _realFftPlans.get(N, dsp::FFTDirection::Inverse);
+
+    std::vector<double> result(N);
+    plan->inverse(real.data(), imag.data(), result.data());
+    return result;
+}
+
+std::shared_ptr<HybridFFTPlanSpec> HybridMath::createFFTPlan(double size, std::optional<bool> inverse) {
+    size_t n = toSize(size, "size");
+    if (n == 0) throw std::runtime_error("FFT size must be positive");
+
+    auto direction = inverse.value_or(false) ? dsp::FFTDirection::Inverse : dsp::FFTDirection::Forward;
+    return std::make_shared<HybridFFTPlan>(_fftPlans.get(n, direction));
+}
+
+std::vector<double> HybridMath::convolve(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) {
     size_t signal_size = signal.size();
     size_t kernel_size = kernel.size();
     if (signal_size == 0 || kernel_size == 0) {
         return std::vector<double>();
     }
-    
-    std::vector<double> result(signal_size + kernel_size - 1, 0.0);
-    
-    for (size_t i = 0; i < signal_size; i++) {
-        for (size_t j = 0; j < kernel_size; j++) {
-            result[i + j] += signal[i] * kernel[j];
+
+    std::vector<double> result(signal_size + kernel_size - 1);
+    dsp::convolve(signal.data(), signal_size, kernel.data(), kernel_size, result.data(), toConvolutionMethod(mode), _realFftPlans);
+    return result;
+}
+
+std::shared_ptr<HybridFilterSpec> HybridMath::createFIRFilter(const std::vector<double>& taps) {
+    return std::make_shared<HybridFilter>(std::make_unique<dsp::FIRFilter>(taps));
+}
+
+std::shared_ptr<HybridFilterSpec> HybridMath::createBiquadFilter(const std::vector<std::vector<double>>& sections) {
+    std::vector<dsp::BiquadFilter::Coefficients> coefficients;
+    coefficients.reserve(sections.size());
+    for (const auto& row : sections) {
+        if (row.size() != 6) {
+            throw std::runtime_error("Biquad sections must have 6 coefficients [b0, b1, b2, a0, a1, a2]");
         }
+        dsp::BiquadFilter::Coefficients c;
+        std::copy(row.begin(), row.end(), c.begin());
+        coefficients.push_back(c);
     }
-    
-    return result;
+    return std::make_shared<HybridFilter>(std::make_unique<dsp::BiquadFilter>(coefficients));
+}
+
+// === ZERO-COPY BUFFER VARIANTS ===
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridMath::fftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    size_t N = asFloat64(real, "real").size;
+    return HybridFFTPlan::runBuffer(*_fftPlans.get(N, dsp::FFTDirection::Forward), real, imag, outReal, outImag);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::convolveBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) {
+    return convolveBufferWith(signal, kernel, out, mode, _realFftPlans);
+}
+
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridMath::rfftBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    return rfftBufferWith(signal, outReal, outImag, _realFftPlans);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::irfftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return irfftBufferWith(real, imag, size, out, _realFftPlans);
+}
+
+// === FLOAT32 BUFFER VARIANTS ===
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridMath::fftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    size_t N = asFloat32(real, "real").size;
+    return HybridFFTPlan::runBuffer(*_floatFftPlans.get(N, dsp::FFTDirection::Forward), real, imag, outReal, outImag);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::convolveBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) {
+    return convolveBufferWith(signal, kernel, out, mode, _floatRealFftPlans);
+}
+
+std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> HybridMath::rfftBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) {
+    return rfftBufferWith(signal, outReal, outImag, _floatRealFftPlans);
+}
+
+std::shared_ptr<ArrayBuffer> HybridMath::irfftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return irfftBufferWith(real, imag, size, out, _floatRealFftPlans);
+}
+
+// === ASYNC VARIANTS ===
+using SpectrumPromise = Promise<std::tuple<std::vector<double>, std::vector<double>>>;
+
+std::shared_ptr<SpectrumPromise> HybridMath::fftAsync(const std::vector<double>& real, const std::vector<double>& imag) {
+    return _tasks.run<std::tuple<std::vector<double>, std::vector<double>>>([this, real, imag] { return fft(real, imag); });
+}
+
+std::shared_ptr<SpectrumPromise> HybridMath::ifftAsync(const std::vector<double>& real, const std::vector<double>& imag) {
+    return _tasks.run<std::tuple<std::vector<double>, std::vector<double>>>([this, real, imag] { return ifft(real, imag); });
+}
+
+std::shared_ptr<SpectrumPromise> HybridMath::rfftAsync(const std::vector<double>& signal) {
+    return _tasks.run<std::tuple<std::vector<double>, std::vector<double>>>([this, signal] { return rfft(signal); });
+}
+
+std::shared_ptr<Promise<std::vector<double>>> HybridMath::convolveAsync(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) {
+    return _tasks.run<std::vector<double>>([this, signal, kernel, mode] { return convolve(signal, kernel, mode); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridMath::convolveBufferAsync(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, std::optional<ConvolutionMode> mode) {
+    auto signal_copy = copyFloat64(signal, "signal");
+    auto kernel_copy = copyFloat64(kernel, "kernel");
+    return _tasks.run<std::shared_ptr<ArrayBuffer>>([this, signal_copy, kernel_copy, mode] {
+        return convolveBuffer(signal_copy, kernel_copy, std::nullopt, mode);
+    });
 }
 
 } // namespace margelo::nitro::rnmath
@@ -1,29 +1,32 @@
 #include "HybridMath.hpp"
+#include "Moments.hpp"
+#include "Quantiles.hpp"
+#include "../utils/BufferUtils.hpp"
 #include <stdexcept>
-#include <algorithm>
-#include <numeric>
 #include <cmath>
 
 namespace margelo::nitro::rnmath {
 
 
 double HybridMath::mean(const std::vector<double>& data) {
-    if (data.empty()) return 0.0;
-    return std::accumulate(data.begin(), data.end(), 0.0) / data.size();
+    return stats::moments(data.data(), data.size()).mean;
 }
 
 double HybridMath::median(const std::vector<double>& data) {
     if (data.empty()) throw std::runtime_error("Cannot find median of empty data");
-    
-    std::vector<double> sorted = data;
-    std::sort(sorted.begin(), sorted.end());
-    
-    size_t n = sorted.size();
-    if (n % 2 == 0) {
-        return (sorted[n/2 - 1] + sorted[n/2]) / 2.0;
-    } else {
-        return sorted[n/2];
-    }
+
+    std::vector<double> scratch = data;
+    double half = 0.5;
+    double result;
+    stats::quantiles(scratch.data(), scratch.size(), &half, &result, 1);
+    return result;
+}
+
+std::vector<double> HybridMath::quantiles(const std::vector<double>& data, const std::vector<double>& probabilities) {
+    std::vector<double> scratch = data;
+    std::vector<double> result(probabilities.size());
+    stats::quantiles(scratch.data(), scratch.size(), probabilities.data(), result.data(), probabilities.size());
+    return result;
 }
 
 double HybridMath::variance(const std::vector<double>& data, std::optional<bool> population) {
@@ -38,26 +41,43 @@ double HybridMath::covariance(const std::vector<double>& a, const std::vector<do
     if (a.size() != b.size()) {
         throw std::runtime_error("Vectors must have same size for covariance");
     }
-    if (a.empty()) return 0.0;
-    
-    double mean_a = mean(a);
-    double mean_b = mean(b);
-    double sum = 0.0;
-    
-    for (size_t i = 0; i < a.size(); i++) {
-        sum += (a[i] - mean_a) * (b[i] - mean_b);
-    }
-    
-    return sum / (a.size() - 1); // Sample covariance
+    return stats::coMoments(a.data(), b.data(), a.size()).covariance(false); // Sample covariance
 }
 
 double HybridMath::correlation(const std::vector<double>& a, const std::vector<double>& b) {
-    double cov = covariance(a, b);
-    double std_a = standardDeviation(a, false);
-    double std_b = standardDeviation(b, false);
-    
-    if (std_a == 0 || std_b == 0) return 0.0;
-    return cov / (std_a * std_b);
+    if (a.size() != b.size()) {
+        throw std::runtime_error("Vectors must have same size for correlation");
+    }
+    return stats::coMoments(a.data(), b.data(), a.size()).correlation();
+}
+
+static SummaryStatistics describeData(const double* data, size_t n, std::optional<bool> population) {
+    if (n == 0) throw std::runtime_error("Cannot describe empty data");
+
+    stats::Moments m = stats::moments(data, n);
+    double variance = m.variance(population.value_or(false));
+    return SummaryStatistics(static_cast<double>(m.count), m.mean * m.count, m.mean, variance, std::sqrt(variance), m.min, m.max);
+}
+
+SummaryStatistics HybridMath::describe(const std::vector<double>& data, std::optional<bool> population) {
+    return describeData(data.data(), data.size(), population);
+}
+
+SummaryStatistics HybridMath::describeBuffer(const std::shared_ptr<ArrayBuffer>& data, std::optional<bool> population) {
+    Float64Buffer v = asFloat64(data, "data");
+    return describeData(v.data, v.size, population);
+}
+
+std::vector<double> HybridMath::quantilesBuffer(const std::shared_ptr<ArrayBuffer>& data, const std::vector<double>& probabilities, std::optional<bool> inPlace) {
+    Float64Buffer v = asFloat64(data, "data");
+    std::vector<double> result(probabilities.size());
+    if (inPlace.value_or(false)) {
+        stats::quantiles(v.data, v.size, probabilities.data(), result.data(), probabilities.size());
+    } else {
+        std::vector<double> scratch(v.data, v.data + v.size);
+        stats::quantiles(scratch.data(), scratch.size(), probabilities.data(), result.data(), probabilities.size());
+    }
+    return result;
 }
 
 } // namespace margelo::nitro::rnmath
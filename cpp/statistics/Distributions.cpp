@@ -0,0 +1,735 @@
+#include "Distributions.hpp"
+#include "../utils/ThreadPool.hpp"
+#include "../utils/VectorMath.hpp"
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace margelo::nitro::rnmath::stats {
+
+using Kind = Distribution::Kind;
+
+// Batch evaluation hands each worker at least this many points
+static constexpr size_t DISTRIBUTION_GRAIN = 4096;
+static constexpr int MAX_SERIES_TERMS = 100000;
+// Newton steps before the solver falls back to bisection. Power-law tails
+// at extreme p make Newton crawl, and bisection finishes in 64 steps.
+static constexpr int MAX_SOLVER_STEPS = 100;
+// Newton converges quadratically, so once a step is this small relative to x
+// the step after it would be below rounding
+static constexpr double SOLVER_TOLERANCE = 1e-9;
+static constexpr double EPS = std::numeric_limits<double>::epsilon();
+// Smallest magnitude kept by the modified Lentz continued fractions
+static constexpr double TINY = 1e-300;
+static constexpr double SQRT_2PI = 2.5066282746310002;
+static constexpr double SQRT1_2 = 0.70710678118654752;
+static constexpr double PI = 3.14159265358979323846;
+static constexpr double INF = std::numeric_limits<double>::infinity();
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+static const char* nameOf(Kind kind) {
+    switch (kind) {
+        case Kind::Normal: return "Normal";
+        case Kind::LogNormal: return "Lognormal";
+        case Kind::Exponential: return "Exponential";
+        case Kind::Gamma: return "Gamma";
+        case Kind::Beta: return "Beta";
+        case Kind::StudentT: return "Student-t";
+        case Kind::ChiSquared: return "Chi-squared";
+        case Kind::Poisson: return "Poisson";
+        case Kind::Binomial: return "Binomial";
+    }
+    return "Unknown";
+}
+
+// === SPECIAL FUNCTIONS ===
+
+static double logBeta(double a, double b) {
+    return std::lgamma(a) + std::lgamma(b) - std::lgamma(a + b);
+}
+
+// Regularized incomplete gamma P(a, x), or Q(a, x) = 1 - P(a, x) when `upper`.
+// Series below a + 1, continued fraction above (Numerical Recipes 6.2).
+static double gammaRegularized(double a, double x, bool upper) {
+    if (!(x > 0)) return upper ? 1.0 : 0.0;
+    if (std::isinf(x)) return upper ? 0.0 : 1.0;
+
+    double prefix = std::exp(a * std::log(x) - x - std::lgamma(a));
+    if (x < a + 1.0) {
+        double term = 1.0 / a;
+        double sum = term;
+        double ap = a;
+        for (int i = 0; i < MAX_SERIES_TERMS; i++) {
+            ap += 1.0;
+            term *= x / ap;
+            sum += term;
+            if (std::fabs(term) < std::fabs(sum) * EPS) break;
+        }
+        double p = sum * prefix;
+        return upper ? 1.0 - p : p;
+    }
+
+    double b = x + 1.0 - a;
+    double c = 1.0 / TINY;
+    double d = 1.0 / b;
+    double h = d;
+    for (int i = 1; i < MAX_SERIES_TERMS; i++) {
+        double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if (std::fabs(d) < TINY) d = TINY;
+        c = b + an / c;
+        if (std::fabs(c) < TINY) c = TINY;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < EPS) break;
+    }
+    double q = prefix * h;
+    return upper ? q : 1.0 - q;
+}
+
+static double betaContinuedFraction(double a, double b, double x) {
+    double qab = a + b;
+    double qap = a + 1.0;
+    double qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab * x / qap;
+    if (std::fabs(d) < TINY) d = TINY;
+    d = 1.0 / d;
+    double h = d;
+    for (int m = 1; m < MAX_SERIES_TERMS; m++) {
+        double m2 = 2.0 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < TINY) d = TINY;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < TINY) c = TINY;
+        d = 1.0 / d;
+        h *= d * c;
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < TINY) d = TINY;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < TINY) c = TINY;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < EPS) break;
+    }
+    return h;
+}
+
+// Regularized incomplete beta I_x(a, b), or 1 - I_x(a, b) when `upper`.
+// `y` is 1 - x, passed separately so callers can keep it accurate near 1.
+static double betaRegularized(double a, double b, double x, double y, bool upper) {
+    if (!(x > 0)) return upper ? 1.0 : 0.0;
+    if (!(y > 0)) return upper ? 0.0 : 1.0;
+
+    double front = std::exp(a * std::log(x) + b * std::log(y) - logBeta(a, b));
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        double v = front * betaContinuedFraction(a, b, x) / a;
+        return upper ? 1.0 - v : v;
+    }
+    double v = front * betaContinuedFraction(b, a, y) / b;
+    return upper ? v : 1.0 - v;
+}
+
+// Inverse of the standard normal CDF: Acklam's rational approximation
+// refined by one Halley step, accurate to a few ULP
+static double normalQuantile(double p) {
+    if (p <= 0.0) return -INF;
+    if (p >= 1.0) return INF;
+    // 1 - p is exact here, and the refinement below is accurate in the lower tail
+    if (p > 0.5) return -normalQuantile(1.0 - p);
+
+    static constexpr double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static constexpr double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01};
+    static constexpr double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static constexpr double d[4] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+
+    double x;
+    if (p < 0.02425) {
+        double q = std::sqrt(-2.0 * std::log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    } else {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    }
+
+    double density = std::exp(-0.5 * x * x) / SQRT_2PI;
+    if (density > 0.0) {
+        double u = (0.5 * std::erfc(-x * SQRT1_2) - p) / density;
+        x = x - u / (1.0 + 0.5 * x * u);
+    }
+    return x;
+}
+
+static double gammaDensity(double x, double a) {
+    if (x < 0.0) return 0.0;
+    if (std::isinf(x)) return 0.0;
+    double log_x = a == 1.0 ? 0.0 : (a - 1.0) * std::log(x);
+    return std::exp(log_x - x - std::lgamma(a));
+}
+
+static double betaDensity(double x, double a, double b) {
+    if (x < 0.0 || x > 1.0) return 0.0;
+    double log_x = a == 1.0 ? 0.0 : (a - 1.0) * std::log(x);
+    double log_y = b == 1.0 ? 0.0 : (b - 1.0) * std::log1p(-x);
+    return std::exp(log_x + log_y - logBeta(a, b));
+}
+
+static double studentDensity(double t, double v) {
+    return std::exp(std::lgamma(0.5 * (v + 1.0)) - std::lgamma(0.5 * v) - 0.5 * std::log(v * PI) - 0.5 * (v + 1.0) * std::log1p(t * t / v));
+}
+
+// P(T <= t), or P(T > t) when `upper`
+static double studentTail(double t, double v, bool upper) {
+    if (std::isinf(t)) return (t > 0) != upper ? 1.0 : 0.0;
+    if (t == 0.0) return 0.5;
+    // P(T > |t|) = I_w(v/2, 1/2) / 2 with w = v / (v + t^2)
+    double t2 = t * t;
+    double tail = 0.5 * betaRegularized(0.5 * v, 0.5, v / (v + t2), t2 / (v + t2), false);
+    return (t < 0) != upper ? tail : 1.0 - tail;
+}
+
+// Maps doubles to unsigned integers in the same order, so bisection can
+// halve the number of doubles left in a bracket, infinite ends included
+static uint64_t orderKey(double x) {
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof bits);
+    return bits >> 63 ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+static double fromOrderKey(uint64_t key) {
+    uint64_t bits = key >> 63 ? key & ~(uint64_t{1} << 63) : ~key;
+    double x;
+    std::memcpy(&x, &bits, sizeof x);
+    return x;
+}
+
+// Smallest x with tail(x, false) >= p: safeguarded Newton on whichever tail
+// holds the target accurately, falling back to bisection inside the bracket
+// [lo, hi]. `q` is 1 - p, passed separately so callers can keep it exact.
+template <typename Tail, typename Density>
+static double solveQuantile(double p, double q, double x, double lo, double hi, Tail tail, Density density) {
+    bool upper = p > 0.5;
+    // Increases with x on either tail
+    auto gap = [&](double x) { return upper ? q - tail(x, true) : tail(x, false) - p; };
+    for (int i = 0; i < MAX_SOLVER_STEPS; i++) {
+        double f = gap(x);
+        if (f == 0.0) return x;
+        if (f < 0.0) lo = x;
+        else hi = x;
+
+        double next = x - f / density(x);
+        bool newton = next > lo && next < hi;
+        if (!newton) {
+            if (std::isinf(hi)) next = x + std::max(1.0, std::fabs(x));
+            else if (std::isinf(lo)) next = x - std::max(1.0, std::fabs(x));
+            // Positive brackets can span many decades, e.g. tiny gamma quantiles
+            else if (lo == 0.0) next = hi / 16.0;
+            else if (lo > 0.0 && hi > 16.0 * lo) next = std::sqrt(lo * hi);
+            else next = 0.5 * (lo + hi);
+        }
+        if (newton && std::fabs(next - x) <= SOLVER_TOLERANCE * std::fabs(next)) return next;
+        if (std::fabs(next - x) <= 2.0 * EPS * std::fabs(next)) return next;
+        x = next;
+    }
+
+    uint64_t below = orderKey(lo);
+    uint64_t above = orderKey(hi);
+    while (above - below > 1) {
+        uint64_t key = below + (above - below) / 2;
+        double f = gap(fromOrderKey(key));
+        if (f == 0.0) return fromOrderKey(key);
+        if (f < 0.0) below = key;
+        else above = key;
+    }
+    return fromOrderKey(above);
+}
+
+// Beta quantile known to lie in [0, 0.5]
+static double betaLowerQuantile(double a, double b, double p, double q) {
+    // I_x(a, b) ~ x^a / (a B(a, b)) for small x
+    double guess = std::exp((std::log(p) + std::log(a) - logBeta(a, b)) / a);
+    if (!(guess > 0.0 && guess < 0.5)) guess = 0.25;
+    return solveQuantile(p, q, guess, 0.0, 0.5,
+                         [a, b](double x, bool upper) { return betaRegularized(a, b, x, 1.0 - x, upper); },
+                         [a, b](double x) { return betaDensity(x, a, b); });
+}
+
+// The solver's tolerance is relative to x, which near 1 would swamp the
+// upper tail 1 - x. Quantiles above 0.5 are therefore solved as 1 - y for
+// the reflected Beta(b, a), so that y keeps its relative accuracy.
+static double betaQuantile(double a, double b, double p, double q) {
+    if (p > betaRegularized(a, b, 0.5, 0.5, false)) return 1.0 - betaLowerQuantile(b, a, q, p);
+    return betaLowerQuantile(a, b, p, q);
+}
+
+// Smallest integer k in [lo, hi] with P(X <= k) >= p, by galloping from
+// `guess` and bisecting
+template <typename Tail>
+static double discreteQuantile(double p, double guess, double lo, double hi, Tail tail) {
+    bool upper = p > 0.5;
+    double target = upper ? 1.0 - p : p;
+    auto reaches = [&](double k) { return upper ? tail(k, true) <= target : tail(k, false) >= target; };
+
+    double k = std::clamp(std::floor(guess), lo, hi);
+    // Invariant: `below` does not reach p (or is lo - 1), `above` does
+    double below, above;
+    if (reaches(k)) {
+        above = k;
+        for (double step = 1.0;; step *= 2.0) {
+            double next = above - step;
+            if (next < lo) { below = lo - 1.0; break; }
+            if (!reaches(next)) { below = next; break; }
+            above = next;
+        }
+    } else {
+        below = k;
+        for (double step = 1.0;; step *= 2.0) {
+            double next = below + step;
+            if (next >= hi) { above = hi; break; }
+            if (reaches(next)) { above = next; break; }
+            below = next;
+        }
+    }
+    while (above - below > 1.0) {
+        double mid = std::floor(0.5 * (below + above));
+        if (reaches(mid)) above = mid;
+        else below = mid;
+    }
+    return above;
+}
+
+// === SAMPLERS ===
+
+// Marsaglia & Tsang's method, boosted by U^(1/a) for shapes below 1
+static double standardGamma(Random& random, double a) {
+    if (a < 1.0) {
+        double u = random.uniform();
+        return standardGamma(random, a + 1.0) * std::pow(u, 1.0 / a);
+    }
+    double d = a - 1.0 / 3.0;
+    double c = 1.0 / std::sqrt(9.0 * d);
+    for (;;) {
+        double x, v;
+        do {
+            x = random.normal();
+            v = 1.0 + c * x;
+        } while (v <= 0.0);
+        v = v * v * v;
+        double u = random.uniform();
+        if (u < 1.0 - 0.0331 * x * x * x * x) return d * v;
+        if (std::log(u) < 0.5 * x * x + d * (1.0 - v + std::log(v))) return d * v;
+    }
+}
+
+// Hörmann's transformed rejection with squeeze (PTRS) for lambda >= 10,
+// multiplication of uniforms below
+static double poissonSample(Random& random, double lambda) {
+    if (lambda < 10.0) {
+        double limit = std::exp(-lambda);
+        double k = 0.0;
+        double product = random.uniform();
+        while (product > limit) {
+            k += 1.0;
+            product *= random.uniform();
+        }
+        return k;
+    }
+
+    double slam = std::sqrt(lambda);
+    double log_lambda = std::log(lambda);
+    double b = 0.931 + 2.53 * slam;
+    double a = -0.059 + 0.02483 * b;
+    double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    double vr = 0.9277 - 3.6224 / (b - 2.0);
+    for (;;) {
+        double u = random.uniform() - 0.5;
+        double v = random.uniform();
+        double us = 0.5 - std::fabs(u);
+        double k = std::floor((2.0 * a / us + b) * u + lambda + 0.43);
+        if (us >= 0.07 && v <= vr) return k;
+        if (k < 0.0 || (us < 0.013 && v > us)) continue;
+        if (std::log(v) + std::log(inv_alpha) - std::log(a / (us * us) + b) <= -lambda + k * log_lambda - std::lgamma(k + 1.0)) return k;
+    }
+}
+
+// Hörmann's BTRS for n * p >= 10, sequential inversion below. p <= 0.5.
+static double binomialSampleLow(Random& random, double n, double p) {
+    double q = 1.0 - p;
+    if (n * p < 10.0) {
+        double qn = std::exp(n * std::log1p(-p));
+        double np = n * p;
+        double bound = std::min(n, np + 10.0 * std::sqrt(np * q + 1.0));
+        double k = 0.0;
+        double px = qn;
+        double u = random.uniform();
+        while (u > px) {
+            k += 1.0;
+            if (k > bound) {
+                k = 0.0;
+                px = qn;
+                u = random.uniform();
+            } else {
+                u -= px;
+                px = ((n - k + 1.0) * p * px) / (k * q);
+            }
+        }
+        return k;
+    }
+
+    double spq = std::sqrt(n * p * q);
+    double b = 1.15 + 2.53 * spq;
+    double a = -0.0873 + 0.0248 * b + 0.01 * p;
+    double c = n * p + 0.5;
+    double vr = 0.92 - 4.2 / b;
+    double alpha = (2.83 + 5.1 / b) * spq;
+    double lpq = std::log(p / q);
+    double m = std::floor((n + 1.0) * p);
+    double h = std::lgamma(m + 1.0) + std::lgamma(n - m + 1.0);
+    for (;;) {
+        double u = random.uniform() - 0.5;
+        double v = random.uniform();
+        double us = 0.5 - std::fabs(u);
+        double k = std::floor((2.0 * a / us + b) * u + c);
+        if (k < 0.0 || k > n) continue;
+        if (us >= 0.07 && v <= vr) return k;
+        v = std::log(v * alpha / (a / (us * us) + b));
+        if (v <= h - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0) + (k - m) * lpq) return k;
+    }
+}
+
+static double binomialSample(Random& random, double n, double p) {
+    if (n == 0.0 || p == 0.0) return 0.0;
+    if (p == 1.0) return n;
+    if (p > 0.5) return n - binomialSampleLow(random, n, 1.0 - p);
+    return binomialSampleLow(random, n, p);
+}
+
+// === DISTRIBUTION ===
+
+Distribution::Distribution(Kind kind, const std::vector<double>& params) : _kind(kind), _params(params) {
+    std::vector<double> defaults;
+    size_t required = 0;
+    switch (kind) {
+        case Kind::Normal:
+        case Kind::LogNormal:
+            defaults = {0.0, 1.0};
+            break;
+        case Kind::Exponential:
+            defaults = {1.0};
+            break;
+        case Kind::Gamma:
+            required = 1;
+            defaults = {NaN, 1.0};
+            break;
+        case Kind::Beta:
+        case Kind::Binomial:
+            required = 2;
+            defaults = {NaN, NaN};
+            break;
+        case Kind::StudentT:
+        case Kind::ChiSquared:
+        case Kind::Poisson:
+            required = 1;
+            defaults = {NaN};
+            break;
+    }
+    if (params.size() < required || params.size() > defaults.size()) {
+        throw std::runtime_error(std::string(nameOf(kind)) + " distribution takes " +
+                                 (required == defaults.size() ? std::to_string(required) : std::to_string(required) + " to " + std::to_string(defaults.size())) +
+                                 " parameters, got " + std::to_string(params.size()));
+    }
+    for (size_t i = params.size(); i < defaults.size(); i++) _params.push_back(defaults[i]);
+    for (double value : _params) {
+        if (!std::isfinite(value)) throw std::runtime_error(std::string(nameOf(kind)) + " distribution parameters must be finite");
+    }
+
+    const double* q = _params.data();
+    switch (kind) {
+        case Kind::Normal:
+            if (q[1] <= 0) throw std::runtime_error("Standard deviation must be positive");
+            break;
+        case Kind::LogNormal:
+            if (q[1] <= 0) throw std::runtime_error("Lognormal sigma must be positive");
+            break;
+        case Kind::Exponential:
+            if (q[0] <= 0) throw std::runtime_error("Exponential rate must be positive");
+            break;
+        case Kind::Gamma:
+            if (q[0] <= 0 || q[1] <= 0) throw std::runtime_error("Gamma shape and scale must be positive");
+            break;
+        case Kind::Beta:
+            if (q[0] <= 0 || q[1] <= 0) throw std::runtime_error("Beta alpha and beta must be positive");
+            break;
+        case Kind::StudentT:
+        case Kind::ChiSquared:
+            if (q[0] <= 0) throw std::runtime_error("Degrees of freedom must be positive");
+            break;
+        case Kind::Poisson:
+            if (q[0] <= 0) throw std::runtime_error("Poisson lambda must be positive");
+            break;
+        case Kind::Binomial:
+            if (q[0] < 0 || q[0] != std::floor(q[0])) throw std::runtime_error("Binomial trials must be a non-negative integer");
+            if (q[1] < 0 || q[1] > 1) throw std::runtime_error("Binomial probability must be between 0 and 1");
+            break;
+    }
+}
+
+double Distribution::mean() const {
+    const double* q = _params.data();
+    switch (_kind) {
+        case Kind::Normal: return q[0];
+        case Kind::LogNormal: return std::exp(q[0] + 0.5 * q[1] * q[1]);
+        case Kind::Exponential: return 1.0 / q[0];
+        case Kind::Gamma: return q[0] * q[1];
+        case Kind::Beta: return q[0] / (q[0] + q[1]);
+        case Kind::StudentT: return q[0] > 1.0 ? 0.0 : NaN;
+        case Kind::ChiSquared: return q[0];
+        case Kind::Poisson: return q[0];
+        case Kind::Binomial: return q[0] * q[1];
+    }
+    return NaN;
+}
+
+double Distribution::variance() const {
+    const double* q = _params.data();
+    switch (_kind) {
+        case Kind::Normal: return q[1] * q[1];
+        case Kind::LogNormal: return std::expm1(q[1] * q[1]) * std::exp(2.0 * q[0] + q[1] * q[1]);
+        case Kind::Exponential: return 1.0 / (q[0] * q[0]);
+        case Kind::Gamma: return q[0] * q[1] * q[1];
+        case Kind::Beta: {
+            double s = q[0] + q[1];
+            return q[0] * q[1] / (s * s * (s + 1.0));
+        }
+        case Kind::StudentT:
+            if (q[0] > 2.0) return q[0] / (q[0] - 2.0);
+            return q[0] > 1.0 ? INF : NaN;
+        case Kind::ChiSquared: return 2.0 * q[0];
+        case Kind::Poisson: return q[0];
+        case Kind::Binomial: return q[0] * q[1] * (1.0 - q[1]);
+    }
+    return NaN;
+}
+
+double Distribution::pdf(double x) const {
+    if (std::isnan(x)) return x;
+    const double* q = _params.data();
+    switch (_kind) {
+        case Kind::Normal: {
+            double z = (x - q[0]) / q[1];
+            return std::exp(-0.5 * z * z) / (q[1] * SQRT_2PI);
+        }
+        case Kind::LogNormal: {
+            if (x <= 0.0) return 0.0;
+            double z = (std::log(x) - q[0]) / q[1];
+            return std::exp(-0.5 * z * z) / (x * q[1] * SQRT_2PI);
+        }
+        case Kind::Exponential:
+            return x < 0.0 ? 0.0 : q[0] * std::exp(-q[0] * x);
+        case Kind::Gamma: return gammaDensity(x / q[1], q[0]) / q[1];
+        case Kind::Beta: return betaDensity(x, q[0], q[1]);
+        case Kind::StudentT: return studentDensity(x, q[0]);
+        case Kind::ChiSquared: return 0.5 * gammaDensity(0.5 * x, 0.5 * q[0]);
+        case Kind::Poisson:
+            if (x < 0.0 || x != std::floor(x)) return 0.0;
+            return std::exp(x * std::log(q[0]) - q[0] - std::lgamma(x + 1.0));
+        case Kind::Binomial: {
+            double n = q[0], p = q[1];
+            if (x < 0.0 || x > n || x != std::floor(x)) return 0.0;
+            if (p == 0.0) return x == 0.0 ? 1.0 : 0.0;
+            if (p == 1.0) return x == n ? 1.0 : 0.0;
+            return std::exp(std::lgamma(n + 1.0) - std::lgamma(x + 1.0) - std::lgamma(n - x + 1.0) + x * std::log(p) + (n - x) * std::log1p(-p));
+        }
+    }
+    return NaN;
+}
+
+// P(X <= x), or P(X > x) when `upper`
+static double cumulative(Kind kind, const double* q, double x, bool upper) {
+    if (std::isnan(x)) return x;
+    switch (kind) {
+        case Kind::Normal: {
+            double z = (x - q[0]) / q[1];
+            return 0.5 * std::erfc((upper ? z : -z) * SQRT1_2);
+        }
+        case Kind::LogNormal: {
+            if (x <= 0.0) return upper ? 1.0 : 0.0;
+            double z = (std::log(x) - q[0]) / q[1];
+            return 0.5 * std::erfc((upper ? z : -z) * SQRT1_2);
+        }
+        case Kind::Exponential:
+            if (x <= 0.0) return upper ? 1.0 : 0.0;
+            return upper ? std::exp(-q[0] * x) : -std::expm1(-q[0] * x);
+        case Kind::Gamma: return gammaRegularized(q[0], x / q[1], upper);
+        case Kind::Beta: return betaRegularized(q[0], q[1], x, 1.0 - x, upper);
+        case Kind::StudentT: return studentTail(x, q[0], upper);
+        case Kind::ChiSquared: return gammaRegularized(0.5 * q[0], 0.5 * x, upper);
+        case Kind::Poisson: {
+            if (x < 0.0) return upper ? 1.0 : 0.0;
+            // P(X <= k) = Q(k + 1, lambda)
+            return gammaRegularized(std::floor(x) + 1.0, q[0], !upper);
+        }
+        case Kind::Binomial: {
+            double n = q[0], p = q[1];
+            if (x < 0.0) return upper ? 1.0 : 0.0;
+            double k = std::floor(x);
+            if (k >= n) return upper ? 0.0 : 1.0;
+            // P(X <= k) = I_{1-p}(n - k, k + 1)
+            return betaRegularized(n - k, k + 1.0, 1.0 - p, p, upper);
+        }
+    }
+    return NaN;
+}
+
+double Distribution::cdf(double x) const {
+    return cumulative(_kind, _params.data(), x, false);
+}
+
+double Distribution::ccdf(double x) const {
+    return cumulative(_kind, _params.data(), x, true);
+}
+
+double Distribution::quantile(double p) const {
+    if (!(p >= 0.0 && p <= 1.0)) return NaN;
+    const double* q = _params.data();
+    Kind kind = _kind;
+    auto tail = [kind, q](double x, bool upper) { return cumulative(kind, q, x, upper); };
+
+    switch (_kind) {
+        case Kind::Normal: return q[0] + q[1] * normalQuantile(p);
+        case Kind::LogNormal: return std::exp(q[0] + q[1] * normalQuantile(p));
+        case Kind::Exponential: return p == 1.0 ? INF : -std::log1p(-p) / q[0];
+        case Kind::Gamma:
+        case Kind::ChiSquared: {
+            if (p == 0.0) return 0.0;
+            if (p == 1.0) return INF;
+            // Solved for the standard gamma, then scaled
+            double a = _kind == Kind::Gamma ? q[0] : 0.5 * q[0];
+            double scale = _kind == Kind::Gamma ? q[1] : 2.0;
+            double z = normalQuantile(p);
+            double w = 1.0 - 1.0 / (9.0 * a) + z / (3.0 * std::sqrt(a));
+            // Wilson-Hilferty, or P(a, x) ~ x^a / Gamma(a + 1) when that fails
+            double guess = a >= 1.0 && w > 0.0 ? a * w * w * w : std::exp((std::log(p) + std::lgamma(a + 1.0)) / a);
+            if (!(guess > 0.0 && std::isfinite(guess))) guess = a;
+            double x = solveQuantile(p, 1.0 - p, guess, 0.0, INF,
+                                     [a](double x, bool upper) { return gammaRegularized(a, x, upper); },
+                                     [a](double x) { return gammaDensity(x, a); });
+            return x * scale;
+        }
+        case Kind::Beta: {
+            if (p == 0.0) return 0.0;
+            if (p == 1.0) return 1.0;
+            return betaQuantile(q[0], q[1], p, 1.0 - p);
+        }
+        case Kind::StudentT: {
+            double v = q[0];
+            if (p == 0.0) return -INF;
+            if (p == 1.0) return INF;
+            if (p == 0.5) return 0.0;
+            // Cauchy
+            if (v == 1.0) return p < 0.5 ? -1.0 / std::tan(PI * p) : 1.0 / std::tan(PI * (1.0 - p));
+            double z = normalQuantile(p);
+            double guess = z + (z * z * z + z) / (4.0 * v);
+            return solveQuantile(p, 1.0 - p, guess, -INF, INF, tail, [v](double x) { return studentDensity(x, v); });
+        }
+        case Kind::Poisson:
+        case Kind::Binomial: {
+            double lo = 0.0;
+            double hi = _kind == Kind::Poisson ? INF : q[0];
+            if (p == 0.0) return lo;
+            if (p == 1.0) return hi;
+            double m = mean();
+            double sd = std::sqrt(variance());
+            // Cornish-Fisher guess with the skewness term
+            double z = normalQuantile(p);
+            double skew = sd > 0.0 ? (_kind == Kind::Poisson ? 1.0 / sd : (1.0 - 2.0 * q[1]) / sd) : 0.0;
+            double guess = m + sd * (z + skew * (z * z - 1.0) / 6.0);
+            if (!std::isfinite(guess)) guess = m;
+            return discreteQuantile(p, guess, lo, hi, tail);
+        }
+    }
+    return NaN;
+}
+
+template <typename F>
+static void forEach(const double* in, double* out, size_t n, F f) {
+    ThreadPool& pool = ThreadPool::shared();
+    pool.parallelFor(n, pool.grainFor(n, DISTRIBUTION_GRAIN), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) out[i] = f(in[i]);
+    });
+}
+
+void Distribution::pdf(const double* x, double* out, size_t n) const {
+    forEach(x, out, n, [this](double v) { return pdf(v); });
+}
+
+void Distribution::cdf(const double* x, double* out, size_t n) const {
+    forEach(x, out, n, [this](double v) { return cdf(v); });
+}
+
+void Distribution::quantile(const double* p, double* out, size_t n) const {
+    forEach(p, out, n, [this](double v) { return quantile(v); });
+}
+
+double Distribution::sample(Random& random) const {
+    const double* q = _params.data();
+    switch (_kind) {
+        case Kind::Normal: return q[0] + q[1] * random.normal();
+        case Kind::LogNormal: return std::exp(q[0] + q[1] * random.normal());
+        case Kind::Exponential: return -std::log1p(-random.uniform()) / q[0];
+        case Kind::Gamma: return q[1] * standardGamma(random, q[0]);
+        case Kind::Beta: {
+            double x = standardGamma(random, q[0]);
+            double y = standardGamma(random, q[1]);
+            // Both can underflow for tiny shapes; the limit is a Bernoulli draw
+            if (x + y == 0.0) return random.uniform() < q[0] / (q[0] + q[1]) ? 1.0 : 0.0;
+            return x / (x + y);
+        }
+        case Kind::StudentT: return random.normal() / std::sqrt(2.0 * standardGamma(random, 0.5 * q[0]) / q[0]);
+        case Kind::ChiSquared: return 2.0 * standardGamma(random, 0.5 * q[0]);
+        case Kind::Poisson: return poissonSample(random, q[0]);
+        case Kind::Binomial: return binomialSample(random, q[0], q[1]);
+    }
+    return NaN;
+}
+
+void Distribution::sample(Random& random, double* out, size_t n) const {
+    const double* q = _params.data();
+    switch (_kind) {
+        case Kind::Normal:
+            random.fillNormal(out, n, q[0], q[1]);
+            return;
+        case Kind::LogNormal:
+            random.fillNormal(out, n, q[0], q[1]);
+            vmath::map(vmath::Function::Exp, out, out, n);
+            return;
+        case Kind::Exponential: {
+            // -log(1 - u); 1 - u is exact for 53-bit uniforms
+            random.fillUniform(out, n, 0.0, 1.0);
+            for (size_t i = 0; i < n; i++) out[i] = 1.0 - out[i];
+            vmath::map(vmath::Function::Log, out, out, n);
+            double scale = -1.0 / q[0];
+            for (size_t i = 0; i < n; i++) out[i] *= scale;
+            return;
+        }
+        default:
+            random.fillBlocks(out, n, [this](Random& generator, double* block, size_t count) {
+                for (size_t i = 0; i < count; i++) block[i] = sample(generator);
+            });
+            return;
+    }
+}
+
+} // namespace margelo::nitro::rnmath::stats
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Random.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::stats {
+
+// A probability distribution with validated parameters. pdf, cdf and
+// quantile are scalar functions; the array overloads split the work across
+// the shared ThreadPool.
+//
+// Parameters, in order (defaults in brackets):
+//   Normal       mean [0], stddev [1]
+//   LogNormal    mu [0], sigma [1] of the underlying normal
+//   Exponential  rate [1]
+//   Gamma        shape, scale [1]
+//   Beta         alpha, beta
+//   StudentT     degrees of freedom
+//   ChiSquared   degrees of freedom
+//   Poisson      lambda
+//   Binomial     trials, success probability
+//
+// For Poisson and Binomial, pdf is the probability mass (0 off the integers),
+// cdf(x) = P(X <= floor(x)) and quantile(p) is the smallest integer k with
+// cdf(k) >= p. quantile returns NaN outside [0, 1] and the support's bounds
+// (possibly infinite) at 0 and 1. Tail probabilities are computed directly,
+// not as 1 - cdf, so quantiles near 1 keep their accuracy.
+class Distribution {
+public:
+    enum class Kind { Normal, LogNormal, Exponential, Gamma, Beta, StudentT, ChiSquared, Poisson, Binomial };
+
+    Distribution(Kind kind, const std::vector<double>& params);
+
+    Kind kind() const { return _kind; }
+    // All parameters, defaults filled in
+    const std::vector<double>& params() const { return _params; }
+    bool discrete() const { return _kind == Kind::Poisson || _kind == Kind::Binomial; }
+
+    double mean() const;
+    double variance() const;
+
+    double pdf(double x) const;
+    double cdf(double x) const;
+    // P(X > x)
+    double ccdf(double x) const;
+    double quantile(double p) const;
+
+    void pdf(const double* x, double* out, size_t n) const;
+    void cdf(const double* x, double* out, size_t n) const;
+    void quantile(const double* p, double* out, size_t n) const;
+
+    double sample(Random& random) const;
+    // Fills in Random::STREAM_BLOCK blocks like Random::fillUniform, so the
+    // values do not depend on the number of threads
+    void sample(Random& random, double* out, size_t n) const;
+
+private:
+    Kind _kind;
+    std::vector<double> _params;
+};
+
+} // namespace margelo::nitro::rnmath::stats
@@ -0,0 +1,101 @@
+#include "HybridDistribution.hpp"
+#include "HybridRandomGenerator.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::rnmath {
+
+static stats::Random& unwrapGenerator(const std::shared_ptr<HybridRandomGeneratorSpec>& generator) {
+    auto native = std::dynamic_pointer_cast<HybridRandomGenerator>(generator);
+    if (native == nullptr) {
+        throw std::runtime_error("generator is not a RandomGenerator");
+    }
+    return native->random();
+}
+
+HybridDistribution::HybridDistribution(stats::Distribution distribution, DistributionKind kind)
+    : HybridObject(TAG), _distribution(std::move(distribution)), _kind(kind) { }
+
+
+DistributionKind HybridDistribution::getKind() {
+    return _kind;
+}
+
+std::vector<double> HybridDistribution::getParams() {
+    return _distribution.params();
+}
+
+double HybridDistribution::getMean() {
+    return _distribution.mean();
+}
+
+double HybridDistribution::getVariance() {
+    return _distribution.variance();
+}
+
+std::vector<double> HybridDistribution::evaluate(Evaluate function, const std::vector<double>& x) const {
+    std::vector<double> result(x.size());
+    (_distribution.*function)(x.data(), result.data(), x.size());
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridDistribution::evaluateBuffer(Evaluate function, const std::shared_ptr<ArrayBuffer>& x, const char* name, const std::optional<std::shared_ptr<ArrayBuffer>>& out) const {
+    Float64Buffer vx = asFloat64(x, name);
+    auto result = outputFloat64(out, vx.size);
+    Float64Buffer vr = asFloat64(result, "out");
+    if (overlaps(vr, vx) && vr.data != vx.data) {
+        throw std::runtime_error(std::string("Output buffer must be ") + name + " itself or not overlap it");
+    }
+
+    (_distribution.*function)(vx.data, vr.data, vx.size);
+    return result;
+}
+
+std::vector<double> HybridDistribution::pdf(const std::vector<double>& x) {
+    return evaluate(&stats::Distribution::pdf, x);
+}
+
+std::vector<double> HybridDistribution::cdf(const std::vector<double>& x) {
+    return evaluate(&stats::Distribution::cdf, x);
+}
+
+std::vector<double> HybridDistribution::quantile(const std::vector<double>& p) {
+    return evaluate(&stats::Distribution::quantile, p);
+}
+
+std::shared_ptr<ArrayBuffer> HybridDistribution::pdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return evaluateBuffer(&stats::Distribution::pdf, x, "x", out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridDistribution::cdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return evaluateBuffer(&stats::Distribution::cdf, x, "x", out);
+}
+
+std::shared_ptr<ArrayBuffer> HybridDistribution::quantileBuffer(const std::shared_ptr<ArrayBuffer>& p, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    return evaluateBuffer(&stats::Distribution::quantile, p, "p", out);
+}
+
+std::vector<double> HybridDistribution::sample(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count) {
+    size_t n = toSize(count, "count");
+    stats::Random& random = unwrapGenerator(generator);
+
+    std::vector<double> result(n);
+    _distribution.sample(random, result.data(), n);
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridDistribution::sampleBuffer(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t n = toSize(count, "count");
+    stats::Random& random = unwrapGenerator(generator);
+
+    auto result = outputFloat64(out, n);
+    _distribution.sample(random, asFloat64(result, "out").data, n);
+    return result;
+}
+
+size_t HybridDistribution::getExternalMemorySize() noexcept {
+    return sizeof(stats::Distribution) + _distribution.params().size() * sizeof(double);
+}
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "HybridDistributionSpec.hpp"
+#include "Distributions.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a distribution whose parameters are validated once
+class HybridDistribution : public HybridDistributionSpec {
+public:
+    HybridDistribution(stats::Distribution distribution, DistributionKind kind);
+
+    DistributionKind getKind() override;
+    std::vector<double> getParams() override;
+    double getMean() override;
+    double getVariance() override;
+
+    std::vector<double> pdf(const std::vector<double>& x) override;
+    std::vector<double> cdf(const std::vector<double>& x) override;
+    std::vector<double> quantile(const std::vector<double>& p) override;
+    std::shared_ptr<ArrayBuffer> pdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> cdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> quantileBuffer(const std::shared_ptr<ArrayBuffer>& p, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::vector<double> sample(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count) override;
+    std::shared_ptr<ArrayBuffer> sampleBuffer(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    using Evaluate = void (stats::Distribution::*)(const double*, double*, size_t) const;
+
+    std::vector<double> evaluate(Evaluate function, const std::vector<double>& x) const;
+    std::shared_ptr<ArrayBuffer> evaluateBuffer(Evaluate function, const std::shared_ptr<ArrayBuffer>& x, const char* name, const std::optional<std::shared_ptr<ArrayBuffer>>& out) const;
+
+    stats::Distribution _distribution;
+    DistributionKind _kind;
+};
+
+} // namespace margelo::nitro::rnmath
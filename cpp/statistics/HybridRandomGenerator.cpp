@@ -0,0 +1,72 @@
+#include "HybridRandomGenerator.hpp"
+#include "../utils/BufferUtils.hpp"
+#include <stdexcept>
+
+namespace margelo::nitro::rnmath {
+
+struct UniformRange {
+    double min;
+    double max;
+};
+
+static UniformRange toUniformRange(std::optional<double> min, std::optional<double> max) {
+    UniformRange range{min.value_or(0.0), max.value_or(1.0)};
+    if (!(range.min < range.max)) throw std::runtime_error("Min must be less than max");
+    return range;
+}
+
+static double toStddev(std::optional<double> stddev) {
+    double value = stddev.value_or(1.0);
+    if (!(value > 0)) throw std::runtime_error("Standard deviation must be positive");
+    return value;
+}
+
+HybridRandomGenerator::HybridRandomGenerator(uint64_t seed)
+    : HybridObject(TAG), _random(seed) { }
+
+
+void HybridRandomGenerator::reseed(double seed) {
+    _random.seed(toSize(seed, "seed"));
+}
+
+std::vector<double> HybridRandomGenerator::uniform(double count, std::optional<double> min, std::optional<double> max) {
+    size_t n = toSize(count, "count");
+    UniformRange range = toUniformRange(min, max);
+
+    std::vector<double> result(n);
+    _random.fillUniform(result.data(), n, range.min, range.max);
+    return result;
+}
+
+std::vector<double> HybridRandomGenerator::normal(double count, std::optional<double> mean, std::optional<double> stddev) {
+    size_t n = toSize(count, "count");
+    double sigma = toStddev(stddev);
+
+    std::vector<double> result(n);
+    _random.fillNormal(result.data(), n, mean.value_or(0.0), sigma);
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridRandomGenerator::uniformBuffer(double count, std::optional<double> min, std::optional<double> max, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t n = toSize(count, "count");
+    UniformRange range = toUniformRange(min, max);
+
+    auto result = outputFloat64(out, n);
+    _random.fillUniform(asFloat64(result, "out").data, n, range.min, range.max);
+    return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridRandomGenerator::normalBuffer(double count, std::optional<double> mean, std::optional<double> stddev, const std::optional<std::shared_ptr<ArrayBuffer>>& out) {
+    size_t n = toSize(count, "count");
+    double sigma = toStddev(stddev);
+
+    auto result = outputFloat64(out, n);
+    _random.fillNormal(asFloat64(result, "out").data, n, mean.value_or(0.0), sigma);
+    return result;
+}
+
+size_t HybridRandomGenerator::getExternalMemorySize() noexcept {
+    return sizeof(stats::Random);
+}
+
+} // namespace margelo::nitro::rnmath
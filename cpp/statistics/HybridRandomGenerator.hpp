@@ -0,0 +1,31 @@
+#pragma once
+
+#include "HybridRandomGeneratorSpec.hpp"
+#include "Random.hpp"
+#include <vector>
+#include <optional>
+#include <memory>
+
+namespace margelo::nitro::rnmath {
+
+// JS handle to a seeded generator whose state persists between calls
+class HybridRandomGenerator : public HybridRandomGeneratorSpec {
+public:
+    explicit HybridRandomGenerator(uint64_t seed);
+
+    void reseed(double seed) override;
+    std::vector<double> uniform(double count, std::optional<double> min, std::optional<double> max) override;
+    std::vector<double> normal(double count, std::optional<double> mean, std::optional<double> stddev) override;
+    std::shared_ptr<ArrayBuffer> uniformBuffer(double count, std::optional<double> min, std::optional<double> max, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+    std::shared_ptr<ArrayBuffer> normalBuffer(double count, std::optional<double> mean, std::optional<double> stddev, const std::optional<std::shared_ptr<ArrayBuffer>>& out) override;
+
+    size_t getExternalMemorySize() noexcept override;
+
+    // For samplers that draw from this stream, e.g. HybridDistribution
+    stats::Random& random() { return _random; }
+
+private:
+    stats::Random _random;
+};
+
+} // namespace margelo::nitro::rnmath
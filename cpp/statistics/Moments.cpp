@@ -0,0 +1,257 @@
+#include "Moments.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define RNMATH_MOMENTS_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RNMATH_MOMENTS_SSE2 1
+#endif
+
+namespace margelo::nitro::rnmath::stats {
+
+// Values per chunk: two chunks of paired data still fit in L1, so the second
+// pass over a chunk reads cache instead of memory. Fixed so that results
+// are merged in the same order on every device.
+static constexpr size_t MOMENTS_CHUNK = 2048;
+// Chunks per parallel task
+static constexpr size_t MIN_TASK_CHUNKS = 8;
+static constexpr double INF = std::numeric_limits<double>::infinity();
+
+// === SIMD PRIMITIVES ===
+#if RNMATH_MOMENTS_NEON
+#define RNMATH_MOMENTS_SIMD 1
+using Pack = float64x2_t;
+
+static inline Pack load(const double* p) { return vld1q_f64(p); }
+static inline void store(double* p, Pack a) { vst1q_f64(p, a); }
+static inline Pack splat(double x) { return vdupq_n_f64(x); }
+static inline Pack add(Pack a, Pack b) { return vaddq_f64(a, b); }
+static inline Pack sub(Pack a, Pack b) { return vsubq_f64(a, b); }
+// a * b + c
+static inline Pack madd(Pack a, Pack b, Pack c) { return vfmaq_f64(c, a, b); }
+// NaN lanes of `x` leave `acc` unchanged
+static inline Pack minOf(Pack acc, Pack x) { return vminnmq_f64(acc, x); }
+static inline Pack maxOf(Pack acc, Pack x) { return vmaxnmq_f64(acc, x); }
+#elif RNMATH_MOMENTS_SSE2
+#define RNMATH_MOMENTS_SIMD 1
+using Pack = __m128d;
+
+static inline Pack load(const double* p) { return _mm_loadu_pd(p); }
+static inline void store(double* p, Pack a) { _mm_storeu_pd(p, a); }
+static inline Pack splat(double x) { return _mm_set1_pd(x); }
+static inline Pack add(Pack a, Pack b) { return _mm_add_pd(a, b); }
+static inline Pack sub(Pack a, Pack b) { return _mm_sub_pd(a, b); }
+static inline Pack madd(Pack a, Pack b, Pack c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+// minpd returns its second operand when either is NaN
+static inline Pack minOf(Pack acc, Pack x) { return _mm_min_pd(x, acc); }
+static inline Pack maxOf(Pack acc, Pack x) { return _mm_max_pd(x, acc); }
+#endif
+
+#if RNMATH_MOMENTS_SIMD
+static inline double sumLanes(Pack a) {
+    double lanes[2];
+    store(lanes, a);
+    return lanes[0] + lanes[1];
+}
+#endif
+
+// === CHUNK KERNELS ===
+
+struct Range {
+    double sum = 0.0;
+    double min = INF;
+    double max = -INF;
+};
+
+static Range sumRange(const double* x, size_t n) {
+    Range r;
+    size_t i = 0;
+#if RNMATH_MOMENTS_SIMD
+    Pack s0 = splat(0.0), s1 = s0;
+    Pack lo0 = splat(INF), lo1 = lo0;
+    Pack hi0 = splat(-INF), hi1 = hi0;
+    for (; i + 4 <= n; i += 4) {
+        Pack v0 = load(x + i), v1 = load(x + i + 2);
+        s0 = add(s0, v0);
+        s1 = add(s1, v1);
+        lo0 = minOf(lo0, v0);
+        lo1 = minOf(lo1, v1);
+        hi0 = maxOf(hi0, v0);
+        hi1 = maxOf(hi1, v1);
+    }
+    double lo[2], hi[2];
+    store(lo, minOf(lo0, lo1));
+    store(hi, maxOf(hi0, hi1));
+    r.sum = sumLanes(add(s0, s1));
+    r.min = std::min(lo[0], lo[1]);
+    r.max = std::max(hi[0], hi[1]);
+#endif
+    for (; i < n; i++) {
+        r.sum += x[i];
+        if (x[i] < r.min) r.min = x[i];
+        if (x[i] > r.max) r.max = x[i];
+    }
+    return r;
+}
+
+// Sums of d and d^2 for d = x - mean
+static void sumDeviations(const double* x, size_t n, double mean, double& sum_d, double& sum_d2) {
+    size_t i = 0;
+    sum_d = 0.0;
+    sum_d2 = 0.0;
+#if RNMATH_MOMENTS_SIMD
+    Pack m = splat(mean);
+    Pack d0 = splat(0.0), d1 = d0, q0 = d0, q1 = d0;
+    for (; i + 4 <= n; i += 4) {
+        Pack v0 = sub(load(x + i), m), v1 = sub(load(x + i + 2), m);
+        d0 = add(d0, v0);
+        d1 = add(d1, v1);
+        q0 = madd(v0, v0, q0);
+        q1 = madd(v1, v1, q1);
+    }
+    sum_d = sumLanes(add(d0, d1));
+    sum_d2 = sumLanes(add(q0, q1));
+#endif
+    for (; i < n; i++) {
+        double d = x[i] - mean;
+        sum_d += d;
+        sum_d2 += d * d;
+    }
+}
+
+// Sum of da * db for da = a - mean_a, db = b - mean_b
+static double sumCrossDeviations(const double* a, const double* b, size_t n, double mean_a, double mean_b) {
+    size_t i = 0;
+    double sum = 0.0;
+#if RNMATH_MOMENTS_SIMD
+    Pack ma = splat(mean_a), mb = splat(mean_b);
+    Pack c0 = splat(0.0), c1 = c0;
+    for (; i + 4 <= n; i += 4) {
+        c0 = madd(sub(load(a + i), ma), sub(load(b + i), mb), c0);
+        c1 = madd(sub(load(a + i + 2), ma), sub(load(b + i + 2), mb), c1);
+    }
+    sum = sumLanes(add(c0, c1));
+#endif
+    for (; i < n; i++) sum += (a[i] - mean_a) * (b[i] - mean_b);
+    return sum;
+}
+
+// Corrected two-pass summary of one chunk: the deviations from the first
+// mean also remove its rounding error
+static Moments chunkMoments(const double* x, size_t n) {
+    Moments m;
+    if (n == 0) return m;
+    Range r = sumRange(x, n);
+    double mean = r.sum / n;
+    double sum_d, sum_d2;
+    sumDeviations(x, n, mean, sum_d, sum_d2);
+
+    m.count = n;
+    m.mean = mean + sum_d / n;
+    m.m2 = sum_d2 - sum_d * sum_d / n;
+    m.min = r.min;
+    m.max = r.max;
+    return m;
+}
+
+static CoMoments chunkCoMoments(const double* a, const double* b, size_t n) {
+    CoMoments m;
+    m.a = chunkMoments(a, n);
+    m.b = chunkMoments(b, n);
+    if (n > 0) m.c = sumCrossDeviations(a, b, n, m.a.mean, m.b.mean);
+    return m;
+}
+
+// Summarizes the fixed chunks of [0, n) in parallel and merges them pairwise
+template <typename Result, typename Chunk>
+static Result reduceChunks(size_t n, Chunk chunk) {
+    if (n <= MOMENTS_CHUNK) return chunk(0, n);
+
+    size_t chunks = (n + MOMENTS_CHUNK - 1) / MOMENTS_CHUNK;
+    std::vector<Result> partial(chunks);
+    ThreadPool& pool = ThreadPool::shared();
+    pool.parallelFor(chunks, pool.grainFor(chunks, MIN_TASK_CHUNKS), [&](size_t c0, size_t c1) {
+        for (size_t c = c0; c < c1; c++) {
+            size_t begin = c * MOMENTS_CHUNK;
+            partial[c] = chunk(begin, std::min(n, begin + MOMENTS_CHUNK) - begin);
+        }
+    });
+    for (size_t step = 1; step < chunks; step *= 2) {
+        for (size_t c = 0; c + step < chunks; c += 2 * step) partial[c].merge(partial[c + step]);
+    }
+    return partial[0];
+}
+
+// === MOMENTS ===
+
+void Moments::merge(const Moments& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    double na = static_cast<double>(count);
+    double nb = static_cast<double>(other.count);
+    double n = na + nb;
+    double delta = other.mean - mean;
+    mean += delta * (nb / n);
+    m2 += other.m2 + delta * delta * (na * nb / n);
+    count += other.count;
+    if (other.min < min) min = other.min;
+    if (other.max > max) max = other.max;
+}
+
+double Moments::variance(bool population) const {
+    if (count < 2) return 0.0;
+    return population ? m2 / count : m2 / (count - 1);
+}
+
+void CoMoments::merge(const CoMoments& other) {
+    if (other.a.count != 0 && a.count != 0) {
+        double na = static_cast<double>(a.count);
+        double nb = static_cast<double>(other.a.count);
+        c += other.c + (other.a.mean - a.mean) * (other.b.mean - b.mean) * (na * nb / (na + nb));
+    } else if (a.count == 0) {
+        c = other.c;
+    }
+    a.merge(other.a);
+    b.merge(other.b);
+}
+
+double CoMoments::covariance(bool population) const {
+    size_t count = a.count;
+    if (count < 2) return 0.0;
+    return population ? c / count : c / (count - 1);
+}
+
+double CoMoments::correlation() const {
+    if (a.m2 == 0.0 || b.m2 == 0.0) return 0.0;
+    double scale = std::sqrt(a.m2 * b.m2);
+    // The product can overflow or underflow for extreme values
+    if (!std::isnormal(scale)) scale = std::sqrt(a.m2) * std::sqrt(b.m2);
+    // Rounding can push |r| just past 1 for perfectly correlated data
+    return std::clamp(c / scale, -1.0, 1.0);
+}
+
+Moments moments(const double* x, size_t n) {
+    return reduceChunks<Moments>(n, [x](size_t begin, size_t count) { return chunkMoments(x + begin, count); });
+}
+
+Moments moments(const float* x, size_t n) {
+    return reduceChunks<Moments>(n, [x](size_t begin, size_t count) {
+        double wide[MOMENTS_CHUNK];
+        std::copy(x + begin, x + begin + count, wide);
+        return chunkMoments(wide, count);
+    });
+}
+
+CoMoments coMoments(const double* a, const double* b, size_t n) {
+    return reduceChunks<CoMoments>(n, [a, b](size_t begin, size_t count) { return chunkCoMoments(a + begin, b + begin, count); });
+}
+
+} // namespace margelo::nitro::rnmath::stats
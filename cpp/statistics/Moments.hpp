@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace margelo::nitro::rnmath::stats {
+
+// Count, mean, sum of squared deviations from the mean (M2), min and max of
+// a sample. Partial results combine with Chan et al.'s pairwise update, so
+// chunks can be summarized independently and merged. min and max skip NaN.
+struct Moments {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    void merge(const Moments& other);
+    // M2 / n, or M2 / (n - 1) for the sample variance. Fewer than two
+    // values have no spread, so both are 0 there.
+    double variance(bool population) const;
+};
+
+// Moments of two paired samples plus their co-moment
+struct CoMoments {
+    Moments a;
+    Moments b;
+    // Sum of (a - mean_a) * (b - mean_b)
+    double c = 0.0;
+
+    void merge(const CoMoments& other);
+    // Same normalization as Moments::variance, also 0 below two pairs
+    double covariance(bool population) const;
+    // Pearson correlation, 0 when either sample is constant
+    double correlation() const;
+};
+
+// Both read the data once. Each fixed-size chunk is summarized while it is in
+// cache with SIMD sums and a corrected two-pass M2, and chunks are merged in
+// order, so the result does not depend on the number of threads.
+Moments moments(const double* x, size_t n);
+// float32 data is widened to double one chunk at a time
+Moments moments(const float* x, size_t n);
+CoMoments coMoments(const double* a, const double* b, size_t n);
+
+} // namespace margelo::nitro::rnmath::stats
@@ -1,4 +1,5 @@
 #include "../HybridMath.hpp"
+#include "HybridDistribution.hpp"
 #include <stdexcept>
 #include <cmath>
 
@@ -25,4 +26,25 @@ double HybridMath::normalCDF(double x, std::optional<double> mean, std::optional
     return 0.5 * (1 + erf((x - mean_val) / (stddev_val * std::sqrt(2))));
 }
 
+static stats::Distribution::Kind toKind(DistributionKind kind) {
+    using Kind = stats::Distribution::Kind;
+    switch (kind) {
+        case DistributionKind::NORMAL: return Kind::Normal;
+        case DistributionKind::LOGNORMAL: return Kind::LogNormal;
+        case DistributionKind::EXPONENTIAL: return Kind::Exponential;
+        case DistributionKind::GAMMA: return Kind::Gamma;
+        case DistributionKind::BETA: return Kind::Beta;
+        case DistributionKind::STUDENTT: return Kind::StudentT;
+        case DistributionKind::CHISQUARED: return Kind::ChiSquared;
+        case DistributionKind::POISSON: return Kind::Poisson;
+        case DistributionKind::BINOMIAL: return Kind::Binomial;
+    }
+    throw std::runtime_error("Unknown distribution kind");
+}
+
+std::shared_ptr<HybridDistributionSpec> HybridMath::createDistribution(DistributionKind kind, const std::optional<std::vector<double>>& params) {
+    stats::Distribution distribution(toKind(kind), params.value_or(std::vector<double>{}));
+    return std::make_shared<HybridDistribution>(std::move(distribution), kind);
+}
+
 } // namespace margelo::nitro::rnmath
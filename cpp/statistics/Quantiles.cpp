@@ -0,0 +1,89 @@
+#include "Quantiles.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+namespace margelo::nitro::rnmath::stats {
+
+// Moves the order statistics at `ranks` (sorted, distinct, inside
+// [begin, end)) to where a full sort would put them, with no larger value
+// before and no smaller value after each of them
+static void selectRanks(double* data, size_t begin, size_t end, const size_t* ranks, size_t count) {
+    while (count > 0) {
+        size_t mid = count / 2;
+        size_t k = ranks[mid];
+        std::nth_element(data + begin, data + k, data + end);
+        selectRanks(data, begin, k, ranks, mid);
+        begin = k + 1;
+        ranks += mid + 1;
+        count -= mid + 1;
+    }
+}
+
+void quantiles(double* data, size_t n, const double* probs, double* out, size_t count) {
+    if (n == 0) throw std::runtime_error("Cannot find quantiles of empty data");
+    for (size_t i = 0; i < count; i++) {
+        if (!(probs[i] >= 0.0 && probs[i] <= 1.0)) {
+            throw std::runtime_error("Quantile probabilities must be between 0 and 1");
+        }
+    }
+    // NaN has no place in the order, and would break nth_element's ordering
+    if (std::any_of(data, data + n, [](double v) { return std::isnan(v); })) {
+        std::fill(out, out + count, std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+
+    // Lower order statistic and interpolation weight for each probability
+    std::vector<size_t> lower(count);
+    std::vector<double> weight(count);
+    for (size_t i = 0; i < count; i++) {
+        double h = (n - 1) * probs[i];
+        lower[i] = std::min(static_cast<size_t>(h), n - 1);
+        weight[i] = h - lower[i];
+    }
+    std::vector<size_t> ranks = lower;
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    selectRanks(data, 0, n, ranks.data(), ranks.size());
+
+    // Values after each selected rank up to the next one are unordered but
+    // no smaller than it, so the next order statistic is their minimum. Found
+    // once per rank that some probability interpolates from.
+    std::vector<double> upper(ranks.size());
+    std::vector<bool> needed(ranks.size(), false);
+    for (size_t i = 0; i < count; i++) {
+        if (weight[i] > 0.0 && lower[i] + 1 < n) {
+            needed[std::lower_bound(ranks.begin(), ranks.end(), lower[i]) - ranks.begin()] = true;
+        }
+    }
+    for (size_t r = 0; r < ranks.size(); r++) {
+        if (!needed[r]) continue;
+        size_t end = r + 1 < ranks.size() ? ranks[r + 1] + 1 : n;
+        upper[r] = *std::min_element(data + ranks[r] + 1, data + end);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t k = lower[i];
+        double below = data[k];
+        if (weight[i] == 0.0 || k + 1 == n) {
+            out[i] = below;
+            continue;
+        }
+        double above = upper[std::lower_bound(ranks.begin(), ranks.end(), k) - ranks.begin()];
+        if (below == above) {
+            out[i] = below;
+        } else if (std::isinf(below) || std::isinf(above)) {
+            // An infinite neighbour dominates; the lerp would give inf - inf.
+            // Both infinite means -inf to +inf, which has no midpoint.
+            out[i] = !std::isinf(above) ? below
+                   : !std::isinf(below) ? above
+                   : std::numeric_limits<double>::quiet_NaN();
+        } else {
+            out[i] = below + weight[i] * (above - below);
+        }
+    }
+}
+
+} // namespace margelo::nitro::rnmath::stats
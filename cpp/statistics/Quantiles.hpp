@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+namespace margelo::nitro::rnmath::stats {
+
+// Sample quantiles of data[0..n) at each of probs[0..count), written to out.
+// Interpolates linearly between the order statistics around (n - 1) * p,
+// numpy's and R's default definition, so p = 0.5 is the median.
+//
+// Reorders `data`: one introselect (std::nth_element) per distinct order
+// statistic, each confined to the part left unsorted by the previous ones,
+// O(n log count) in total instead of a full sort. The upper neighbour for
+// interpolation is the minimum of the partition right of the lower one,
+// found once per rank. An infinite neighbour is the result as is.
+// Every result is NaN when the data contains NaN. Throws when n is 0 or a
+// probability is outside [0, 1].
+void quantiles(double* data, size_t n, const double* probs, double* out, size_t count);
+
+} // namespace margelo::nitro::rnmath::stats
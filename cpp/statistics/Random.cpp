@@ -0,0 +1,230 @@
+#include "Random.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace margelo::nitro::rnmath::stats {
+
+// Uniforms are converted in blocks of this many values
+static constexpr size_t RANDOM_BLOCK = 256;
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// Jump polynomials from the xoshiro256 reference implementation
+static constexpr uint64_t JUMP[4] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+static constexpr uint64_t LONG_JUMP[4] = {0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull};
+
+// One scalar xoshiro256++ state, used to derive the lanes
+struct Xoshiro256 {
+    uint64_t s[4];
+
+    uint64_t next() {
+        uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    // Advances by 2^128 steps
+    void jump() {
+        uint64_t t[4] = {0, 0, 0, 0};
+        for (uint64_t word : JUMP) {
+            for (int b = 0; b < 64; b++) {
+                if (word & (uint64_t{1} << b)) {
+                    for (int i = 0; i < 4; i++) t[i] ^= s[i];
+                }
+                next();
+            }
+        }
+        std::copy(t, t + 4, s);
+    }
+};
+
+// Marsaglia & Tsang's 256-layer ziggurat for the standard normal density,
+// with 52-bit integer acceptance thresholds (the layout numpy uses)
+struct Ziggurat {
+    static constexpr double R = 3.6541528853610088;
+    static constexpr double INV_R = 1.0 / R;
+    static constexpr double VOLUME = 4.92867323399e-3;
+
+    uint64_t k[256];
+    double w[256];
+    double f[256];
+
+    Ziggurat() {
+        const double m = 0x1.0p52;
+        double dn = R, tn = R;
+        double q = VOLUME / std::exp(-0.5 * dn * dn);
+        k[0] = static_cast<uint64_t>((dn / q) * m);
+        k[1] = 0;
+        w[0] = q / m;
+        w[255] = dn / m;
+        f[0] = 1.0;
+        f[255] = std::exp(-0.5 * dn * dn);
+        for (int i = 254; i >= 1; i--) {
+            dn = std::sqrt(-2.0 * std::log(VOLUME / dn + std::exp(-0.5 * dn * dn)));
+            k[i + 1] = static_cast<uint64_t>((dn / tn) * m);
+            tn = dn;
+            f[i] = std::exp(-0.5 * dn * dn);
+            w[i] = dn / m;
+        }
+    }
+};
+
+static const Ziggurat& ziggurat() {
+    static const Ziggurat table;
+    return table;
+}
+
+
+Random::Random(uint64_t seed) {
+    this->seed(seed);
+}
+
+void Random::seed(uint64_t seed) {
+    Xoshiro256 lane;
+    for (uint64_t& word : lane.s) word = splitmix64(seed);
+    for (size_t l = 0; l < LANES; l++) {
+        for (int i = 0; i < 4; i++) _state[i][l] = lane.s[i];
+        lane.jump();
+    }
+    _buffered = LANES;
+}
+
+void Random::longJump() {
+    uint64_t t[4][LANES] = {};
+    uint64_t discard[LANES];
+    for (uint64_t word : LONG_JUMP) {
+        for (int b = 0; b < 64; b++) {
+            if (word & (uint64_t{1} << b)) {
+                for (int i = 0; i < 4; i++) {
+                    for (size_t l = 0; l < LANES; l++) t[i][l] ^= _state[i][l];
+                }
+            }
+            step(discard);
+        }
+    }
+    std::copy(&t[0][0], &t[0][0] + 4 * LANES, &_state[0][0]);
+    _buffered = LANES;
+}
+
+void Random::step(uint64_t* out) {
+    uint64_t* s0 = _state[0];
+    uint64_t* s1 = _state[1];
+    uint64_t* s2 = _state[2];
+    uint64_t* s3 = _state[3];
+    for (size_t l = 0; l < LANES; l++) {
+        out[l] = rotl(s0[l] + s3[l], 23) + s0[l];
+        uint64_t t = s1[l] << 17;
+        s2[l] ^= s0[l];
+        s3[l] ^= s1[l];
+        s1[l] ^= s2[l];
+        s0[l] ^= s3[l];
+        s2[l] ^= t;
+        s3[l] = rotl(s3[l], 45);
+    }
+}
+
+void Random::refill() {
+    step(_buffer);
+    _buffered = 0;
+}
+
+void Random::fillBits(uint64_t* out, size_t n) {
+    size_t i = 0;
+    while (i < n && _buffered < LANES) out[i++] = _buffer[_buffered++];
+    for (; i + LANES <= n; i += LANES) step(out + i);
+    while (i < n) out[i++] = next();
+}
+
+void Random::fillBlocks(double* out, size_t n, const BlockFill& fill) {
+    size_t blocks = (n + STREAM_BLOCK - 1) / STREAM_BLOCK;
+    if (blocks <= 1) {
+        fill(*this, out, n);
+        return;
+    }
+
+    // Block starts are derived one after another, before any block draws
+    std::vector<Random> streams(blocks, *this);
+    Random next = *this;
+    for (size_t b = 1; b < blocks; b++) {
+        next.longJump();
+        streams[b] = next;
+    }
+    next.longJump();
+
+    ThreadPool::shared().parallelFor(blocks, 1, [&](size_t b0, size_t b1) {
+        for (size_t b = b0; b < b1; b++) {
+            size_t begin = b * STREAM_BLOCK;
+            fill(streams[b], out + begin, std::min(STREAM_BLOCK, n - begin));
+        }
+    });
+    *this = next;
+}
+
+void Random::uniformBlock(double* out, size_t n, double min, double max) {
+    double range = max - min;
+    uint64_t bits[RANDOM_BLOCK];
+    for (size_t i = 0; i < n; i += RANDOM_BLOCK) {
+        size_t len = std::min(RANDOM_BLOCK, n - i);
+        fillBits(bits, len);
+        for (size_t j = 0; j < len; j++) {
+            out[i + j] = min + range * (static_cast<double>(bits[j] >> 11) * 0x1.0p-53);
+        }
+    }
+}
+
+void Random::fillUniform(double* out, size_t n, double min, double max) {
+    fillBlocks(out, n, [min, max](Random& r, double* o, size_t len) { r.uniformBlock(o, len, min, max); });
+}
+
+double Random::normal() {
+    const Ziggurat& z = ziggurat();
+    for (;;) {
+        // 8 bits pick the layer, 1 the sign and 52 the position in the layer
+        uint64_t r = next();
+        size_t layer = r & 0xff;
+        r >>= 8;
+        bool negative = r & 1;
+        uint64_t position = (r >> 1) & 0x000fffffffffffffull;
+        double x = position * z.w[layer];
+        if (negative) x = -x;
+        // About 99% of draws land inside the layer's rectangle
+        if (position < z.k[layer]) return x;
+
+        if (layer == 0) {
+            // Base layer: sample the tail beyond R
+            for (;;) {
+                double xx = -Ziggurat::INV_R * std::log1p(-uniform());
+                double yy = -std::log1p(-uniform());
+                if (yy + yy > xx * xx) return negative ? -(Ziggurat::R + xx) : Ziggurat::R + xx;
+            }
+        }
+        if ((z.f[layer - 1] - z.f[layer]) * uniform() + z.f[layer] < std::exp(-0.5 * x * x)) return x;
+    }
+}
+
+void Random::normalBlock(double* out, size_t n, double mean, double stddev) {
+    for (size_t i = 0; i < n; i++) out[i] = mean + stddev * normal();
+}
+
+void Random::fillNormal(double* out, size_t n, double mean, double stddev) {
+    fillBlocks(out, n, [mean, stddev](Random& r, double* o, size_t len) { r.normalBlock(o, len, mean, stddev); });
+}
+
+} // namespace margelo::nitro::rnmath::stats
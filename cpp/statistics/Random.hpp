@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace margelo::nitro::rnmath::stats {
+
+// xoshiro256++ pseudo-random generator (Blackman & Vigna), run as LANES
+// interleaved streams so every step advances all lanes with the same
+// 64-bit adds, shifts and xors, which compilers turn into SIMD code.
+// Lane i starts i jumps of 2^128 draws after lane 0, so the lanes never
+// overlap. The output is lane 0, lane 1, ..., lane 0, ... in turn.
+//
+// Fills of more than STREAM_BLOCK values are split into blocks of that size.
+// The first block continues the current stream. Block b > 0 draws from the
+// stream long-jumped b times (2^192 draws per jump), and afterwards the
+// generator continues from the first unused jump. Blocks run on the shared
+// ThreadPool, and the output does not depend on the number of threads. A
+// given seed and sequence of calls always gives the same values; smaller
+// fills give the same values however the draws are split into calls.
+//
+// Not thread-safe; give each thread its own generator.
+class Random {
+public:
+    static constexpr size_t LANES = 4;
+    static constexpr size_t STREAM_BLOCK = 65536;
+
+    // The 256-bit state is expanded from `seed` with splitmix64
+    explicit Random(uint64_t seed);
+
+    void seed(uint64_t seed);
+    // Advances every lane by 2^192 draws and drops buffered output
+    void longJump();
+
+    uint64_t next() {
+        if (_buffered == LANES) refill();
+        return _buffer[_buffered++];
+    }
+    // Uniform in [0, 1) with 53 random bits
+    double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+    // Standard normal, ziggurat method with 256 layers
+    double normal();
+
+    void fillBits(uint64_t* out, size_t n);
+    // Uniform in [min, max)
+    void fillUniform(double* out, size_t n, double min, double max);
+    void fillNormal(double* out, size_t n, double mean, double stddev);
+
+    // Runs fill(generator, out, count) over the blocks described above, for
+    // samplers built on top of this generator
+    using BlockFill = std::function<void(Random& generator, double* out, size_t count)>;
+    void fillBlocks(double* out, size_t n, const BlockFill& fill);
+
+private:
+    // Advances every lane one step and returns its outputs in `out`
+    void step(uint64_t* out);
+    void refill();
+    void uniformBlock(double* out, size_t n, double min, double max);
+    void normalBlock(double* out, size_t n, double mean, double stddev);
+
+    // _state[word][lane], so a step works on contiguous lanes
+    alignas(32) uint64_t _state[4][LANES];
+    uint64_t _buffer[LANES];
+    size_t _buffered = LANES;
+};
+
+} // namespace margelo::nitro::rnmath::stats
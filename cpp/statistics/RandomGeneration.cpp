@@ -1,48 +1,40 @@
 #include "../HybridMath.hpp"
+#include "HybridRandomGenerator.hpp"
+#include "../utils/BufferUtils.hpp"
 #include <stdexcept>
 #include <random>
+#include <mutex>
 
 namespace margelo::nitro::rnmath {
 
+// Fresh entropy for generators created without a seed
+static uint64_t entropySeed() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
+
+// Callers hold _randomMutex
+HybridRandomGenerator& HybridMath::sharedRandom() {
+    if (_random == nullptr) _random = std::make_shared<HybridRandomGenerator>(entropySeed());
+    return *_random;
+}
 
 std::vector<double> HybridMath::randomUniform(double count, std::optional<double> min, std::optional<double> max) {
     int n = static_cast<int>(count);
     if (n <= 0) throw std::runtime_error("Count must be positive");
-    
-    double min_val = min.value_or(0.0);
-    double max_val = max.value_or(1.0);
-    
-    if (min_val >= max_val) throw std::runtime_error("Min must be less than max");
-    
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<double> dist(min_val, max_val);
-    
-    std::vector<double> result(n);
-    for (int i = 0; i < n; i++) {
-        result[i] = dist(gen);
-    }
-    return result;
+    std::lock_guard<std::mutex> lock(_randomMutex);
+    return sharedRandom().uniform(n, min, max);
 }
 
 std::vector<double> HybridMath::randomNormal(double count, std::optional<double> mean, std::optional<double> stddev) {
     int n = static_cast<int>(count);
     if (n <= 0) throw std::runtime_error("Count must be positive");
-    
-    double mean_val = mean.value_or(0.0);
-    double stddev_val = stddev.value_or(1.0);
-    
-    if (stddev_val <= 0) throw std::runtime_error("Standard deviation must be positive");
-    
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<double> dist(mean_val, stddev_val);
-    
-    std::vector<double> result(n);
-    for (int i = 0; i < n; i++) {
-        result[i] = dist(gen);
-    }
-    return result;
+    std::lock_guard<std::mutex> lock(_randomMutex);
+    return sharedRandom().normal(n, mean, stddev);
+}
+
+std::shared_ptr<HybridRandomGeneratorSpec> HybridMath::createRandomGenerator(std::optional<double> seed) {
+    return std::make_shared<HybridRandomGenerator>(seed.has_value() ? toSize(seed.value(), "seed") : entropySeed());
 }
 
 } // namespace margelo::nitro::rnmath
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+namespace margelo::nitro::rnmath {
+
+// Typed, non-owning view over an ArrayBuffer holding packed values of `T`
+// (the backing store of a JS Float64Array or Float32Array). The buffer must
+// outlive the view.
+template <typename T>
+struct TypedBuffer {
+    T* data = nullptr;
+    size_t size = 0;
+
+    T* begin() const { return data; }
+    T* end() const { return data + size; }
+};
+
+using Float64Buffer = TypedBuffer<double>;
+using Float32Buffer = TypedBuffer<float>;
+
+template <typename T> constexpr const char* scalarName();
+template <> constexpr const char* scalarName<double>() { return "float64"; }
+template <> constexpr const char* scalarName<float>() { return "float32"; }
+
+template <typename T>
+inline TypedBuffer<T> asTyped(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+    if (buffer == nullptr) {
+        throw std::runtime_error(std::string(name) + " buffer is null");
+    }
+    size_t bytes = buffer->size();
+    if (bytes % sizeof(T) != 0) {
+        throw std::runtime_error(std::string(name) + " buffer length must be a multiple of " + std::to_string(sizeof(T)) + " bytes");
+    }
+    if (bytes == 0) return TypedBuffer<T>{};
+
+    uint8_t* data = buffer->data();
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+        throw std::runtime_error(std::string(name) + " buffer is not " + std::to_string(alignof(T)) + "-byte aligned");
+    }
+    return TypedBuffer<T>{reinterpret_cast<T*>(data), bytes / sizeof(T)};
+}
+
+// Returns `out` if given (after checking it holds exactly `count` values),
+// otherwise allocates a fresh native buffer of that size.
+template <typename T>
+inline std::shared_ptr<ArrayBuffer> outputTyped(const std::optional<std::shared_ptr<ArrayBuffer>>& out, size_t count) {
+    if (out.has_value() && out.value() != nullptr) {
+        if (out.value()->size() != count * sizeof(T)) {
+            throw std::runtime_error("Output buffer must hold exactly " + std::to_string(count) + " " + scalarName<T>() + " values");
+        }
+        return out.value();
+    }
+    return ArrayBuffer::allocate(count * sizeof(T));
+}
+
+// Copies a buffer into fresh native memory, for work that outlives the call
+// (JS-backed buffers must not be touched off the JS thread)
+template <typename T>
+inline std::shared_ptr<ArrayBuffer> copyTyped(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+    TypedBuffer<T> view = asTyped<T>(buffer, name);
+    if (view.size == 0) return ArrayBuffer::allocate(0);
+    return ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(view.data), view.size * sizeof(T));
+}
+
+inline Float64Buffer asFloat64(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+    return asTyped<double>(buffer, name);
+}
+
+inline Float32Buffer asFloat32(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+    return asTyped<float>(buffer, name);
+}
+
+inline std::shared_ptr<ArrayBuffer> outputFloat64(const std::optional<std::shared_ptr<ArrayBuffer>>& out, size_t count) {
+    return outputTyped<double>(out, count);
+}
+
+inline std::shared_ptr<ArrayBuffer> outputFloat32(const std::optional<std::shared_ptr<ArrayBuffer>>& out, size_t count) {
+    return outputTyped<float>(out, count);
+}
+
+inline std::shared_ptr<ArrayBuffer> copyFloat64(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+    return copyTyped<double>(buffer, name);
+}
+
+// Converts a JS number used as a count or dimension, rejecting negative,
+// fractional and non-finite values. Casting one outside size_t's range is
+// undefined behaviour, so those are rejected as well.
+inline size_t toSize(double value, const char* name) {
+    if (!(value >= 0) || !std::isfinite(value) || std::floor(value) != value) {
+        throw std::runtime_error(std::string(name) + " must be a non-negative integer");
+    }
+    if (value >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+        throw std::runtime_error(std::string(name) + " is too large");
+    }
+    return static_cast<size_t>(value);
+}
+
+// rows * cols for dimensions passed from JS. Throws instead of wrapping
+// around when the count, or its size in bytes as `T`, overflows size_t;
+// a wrapped product could otherwise match a small buffer.
+template <typename T>
+inline size_t matrixSize(size_t rows, size_t cols) {
+    if (cols != 0 && rows > std::numeric_limits<size_t>::max() / cols / sizeof(T)) {
+        throw std::runtime_error("Matrix is too large");
+    }
+    return rows * cols;
+}
+
+template <typename T>
+inline bool overlaps(const TypedBuffer<T>& a, const TypedBuffer<T>& b) {
+    return a.size > 0 && b.size > 0 && a.data < b.end() && b.data < a.end();
+}
+
+} // namespace margelo::nitro::rnmath
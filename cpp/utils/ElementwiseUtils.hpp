@@ -0,0 +1,34 @@
+#pragma once
+
+#include "ElementwiseFunction.hpp"
+#include "VectorMath.hpp"
+#include <stdexcept>
+
+namespace margelo::nitro::rnmath {
+
+// Element-wise function names from JS to kernels
+inline vmath::Function toVmath(ElementwiseFunction fn) {
+    switch (fn) {
+        case ElementwiseFunction::SIN: return vmath::Function::Sin;
+        case ElementwiseFunction::COS: return vmath::Function::Cos;
+        case ElementwiseFunction::TAN: return vmath::Function::Tan;
+        case ElementwiseFunction::ASIN: return vmath::Function::Asin;
+        case ElementwiseFunction::ACOS: return vmath::Function::Acos;
+        case ElementwiseFunction::ATAN: return vmath::Function::Atan;
+        case ElementwiseFunction::SINH: return vmath::Function::Sinh;
+        case ElementwiseFunction::COSH: return vmath::Function::Cosh;
+        case ElementwiseFunction::TANH: return vmath::Function::Tanh;
+        case ElementwiseFunction::EXP: return vmath::Function::Exp;
+        case ElementwiseFunction::LOG: return vmath::Function::Log;
+        case ElementwiseFunction::LOG2: return vmath::Function::Log2;
+        case ElementwiseFunction::LOG10: return vmath::Function::Log10;
+        case ElementwiseFunction::SQRT: return vmath::Function::Sqrt;
+        case ElementwiseFunction::ABS: return vmath::Function::Abs;
+        case ElementwiseFunction::ERF: return vmath::Function::Erf;
+        case ElementwiseFunction::ERFC: return vmath::Function::Erfc;
+        case ElementwiseFunction::GAMMA: return vmath::Function::Gamma;
+    }
+    throw std::runtime_error("Unknown element-wise function");
+}
+
+} // namespace margelo::nitro::rnmath
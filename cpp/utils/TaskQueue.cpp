@@ -0,0 +1,58 @@
+#include "TaskQueue.hpp"
+
+namespace margelo::nitro::rnmath {
+
+TaskQueue::TaskQueue(size_t capacity) : _capacity(capacity) {
+    _worker = std::thread([this] { workerLoop(); });
+}
+
+TaskQueue::~TaskQueue() {
+    cancelPending();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    _worker.join();
+}
+
+void TaskQueue::post(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_pending.size() < _capacity) {
+            _pending.push_back(std::move(job));
+            _wake.notify_one();
+            return;
+        }
+    }
+    job.reject("Task queue is full (" + std::to_string(_capacity) + " pending tasks)");
+}
+
+size_t TaskQueue::cancelPending() {
+    std::deque<Job> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cancelled.swap(_pending);
+    }
+    // Settle outside the lock, rejection may run continuation code
+    for (auto& job : cancelled) {
+        job.reject("Task was cancelled");
+    }
+    return cancelled.size();
+}
+
+void TaskQueue::workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [&] { return _stop || !_pending.empty(); });
+            if (_pending.empty()) return;
+            job = std::move(_pending.front());
+            _pending.pop_front();
+        }
+        job.run();
+    }
+}
+
+} // namespace margelo::nitro::rnmath
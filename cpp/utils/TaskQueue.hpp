@@ -0,0 +1,74 @@
+#pragma once
+
+#include <NitroModules/Promise.hpp>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <exception>
+#include <cstddef>
+
+namespace margelo::nitro::rnmath {
+
+// Bounded FIFO of jobs run one at a time on a dedicated background thread.
+// Each job settles a Promise, so heavy work never blocks the JS thread. Jobs
+// that have not started yet can be cancelled; a running job always finishes.
+// Parallel kernels inside a job still use the shared ThreadPool.
+class TaskQueue {
+public:
+    explicit TaskQueue(size_t capacity = DEFAULT_CAPACITY);
+    // Cancels pending jobs and waits for the running one
+    ~TaskQueue();
+
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue& operator=(const TaskQueue&) = delete;
+
+    // Queues `fn` and returns a Promise for its result. The Promise is
+    // rejected right away when the queue is full. `fn` must own everything
+    // it touches: JS-backed ArrayBuffers have to be copied before queuing.
+    template <typename T>
+    std::shared_ptr<Promise<T>> run(std::function<T()> fn) {
+        auto promise = Promise<T>::create();
+
+        Job job;
+        job.run = [promise, fn = std::move(fn)] {
+            try {
+                promise->resolve(fn());
+            } catch (...) {
+                promise->reject(std::current_exception());
+            }
+        };
+        job.reject = [promise](const std::string& reason) {
+            promise->reject(std::make_exception_ptr(std::runtime_error(reason)));
+        };
+        post(std::move(job));
+        return promise;
+    }
+
+    // Rejects every job that has not started yet, returns how many there were
+    size_t cancelPending();
+
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+private:
+    struct Job {
+        std::function<void()> run;
+        std::function<void(const std::string&)> reject;
+    };
+
+    size_t _capacity;
+    std::deque<Job> _pending;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _stop = false;
+    std::thread _worker;
+
+    void post(Job job);
+    void workerLoop();
+};
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,172 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace margelo::nitro::rnmath {
+
+// Set on threads that are running ranges, so nested calls run inline
+static thread_local bool insideParallelFor = false;
+
+struct CpuTopology {
+    size_t performanceCores;
+    std::vector<int> affinity; // CPUs to pin workers to, empty for no pinning
+};
+
+static CpuTopology detectTopology() {
+    size_t cores = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+#if defined(__APPLE__)
+    // Apple silicon reports P-cores as performance level 0
+    int performance = 0;
+    size_t length = sizeof(performance);
+    if (sysctlbyname("hw.perflevel0.physicalcpu", &performance, &length, nullptr, 0) == 0 && performance > 0) {
+        return {std::min(static_cast<size_t>(performance), cores), {}};
+    }
+    return {cores, {}};
+#elif defined(__linux__)
+    // big.LITTLE clusters differ in maximum frequency; treat every core above
+    // the slowest cluster as a performance core
+    std::vector<long> max_freq(cores, 0);
+    for (size_t cpu = 0; cpu < cores; cpu++) {
+        std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/cpuinfo_max_freq");
+        if (!(file >> max_freq[cpu])) return {cores, {}};
+    }
+
+    long slowest = *std::min_element(max_freq.begin(), max_freq.end());
+    std::vector<int> fast;
+    for (size_t cpu = 0; cpu < cores; cpu++) {
+        if (max_freq[cpu] > slowest) fast.push_back(static_cast<int>(cpu));
+    }
+    if (fast.empty()) return {cores, {}};
+    return {fast.size(), fast};
+#else
+    return {cores, {}};
+#endif
+}
+
+
+ThreadPool::ThreadPool(size_t workers, std::vector<int> affinity) {
+    _workers.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+        _workers.emplace_back([this, affinity] { workerLoop(affinity); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool = [] {
+        CpuTopology topology = detectTopology();
+        return ThreadPool(topology.performanceCores - 1, topology.affinity);
+    }();
+    return pool;
+}
+
+size_t ThreadPool::grainFor(size_t count, size_t min_grain) const {
+    size_t threads = concurrency();
+    return std::max(min_grain, (count + threads - 1) / threads);
+}
+
+void ThreadPool::workerLoop(const std::vector<int>& affinity) {
+#if defined(__linux__)
+    if (!affinity.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : affinity) CPU_SET(cpu, &set);
+        // Best effort: the scheduler may refuse, which only costs speed
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+#endif
+    insideParallelFor = true;
+
+    uint64_t seen = 0;
+    while (true) {
+        Job* job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [&] { return _stop || (_generation != seen && _job != nullptr); });
+            if (_stop) return;
+            seen = _generation;
+            job = _job;
+            _active++;
+        }
+
+        runRanges(*job);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _active--;
+        }
+        _idle.notify_all();
+    }
+}
+
+void ThreadPool::runRanges(Job& job) {
+    while (true) {
+        size_t begin = job.next.fetch_add(job.grain);
+        if (begin >= job.count) return;
+        size_t end = std::min(begin + job.grain, job.count);
+        try {
+            (*job.fn)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.errorMutex);
+            if (!job.error) job.error = std::current_exception();
+            // Skip the remaining ranges
+            job.next.store(job.count);
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+
+    std::unique_lock<std::mutex> submit(_submitMutex, std::defer_lock);
+    if (count <= grain || _workers.empty() || insideParallelFor || !submit.try_lock()) {
+        fn(0, count);
+        return;
+    }
+
+    Job job;
+    job.fn = &fn;
+    job.count = count;
+    job.grain = grain;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        _generation++;
+    }
+    _wake.notify_all();
+
+    insideParallelFor = true;
+    runRanges(job);
+    insideParallelFor = false;
+
+    // Every range has been claimed; wait for the workers still running one
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _job = nullptr;
+        _idle.wait(lock, [&] { return _active == 0; });
+    }
+
+    if (job.error) std::rethrow_exception(job.error);
+}
+
+} // namespace margelo::nitro::rnmath
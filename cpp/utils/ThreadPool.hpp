@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::rnmath {
+
+// Persistent pool of worker threads for data-parallel kernels.
+// The calling thread always takes part in the work, so a pool of N workers
+// runs N + 1 ranges at once. Ranges are handed out dynamically, which keeps
+// fast and slow cores busy on heterogeneous (big.LITTLE) CPUs.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t workers, std::vector<int> affinity = {});
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool with one thread per performance core, the caller included.
+    // On big.LITTLE devices the workers are pinned to the big cores.
+    static ThreadPool& shared();
+
+    // Number of threads taking part in parallelFor, the caller included
+    size_t concurrency() const { return _workers.size() + 1; }
+
+    // Calls fn(begin, end) on disjoint ranges of at most `grain` items that
+    // together cover [0, count), and returns once all of them have run.
+    // Runs fn(0, count) inline when it fits in one range, when called from
+    // inside a parallelFor, or while another thread is using the pool.
+    // The first exception thrown by fn is rethrown to the caller.
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+    // Grain that splits `count` items into about `concurrency()` ranges
+    // of at least `min_grain` items each
+    size_t grainFor(size_t count, size_t min_grain) const;
+
+private:
+    struct Job {
+        const std::function<void(size_t, size_t)>* fn;
+        size_t count;
+        size_t grain;
+        std::atomic<size_t> next{0};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    std::vector<std::thread> _workers;
+    std::mutex _submitMutex; // held by the thread currently driving a job
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _idle;
+    Job* _job = nullptr;
+    uint64_t _generation = 0;
+    size_t _active = 0;
+    bool _stop = false;
+
+    void workerLoop(const std::vector<int>& affinity);
+    static void runRanges(Job& job);
+};
+
+} // namespace margelo::nitro::rnmath
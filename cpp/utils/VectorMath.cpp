@@ -0,0 +1,490 @@
+#include "VectorMath.hpp"
+#include "ThreadPool.hpp"
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define RNMATH_VMATH_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RNMATH_VMATH_SSE2 1
+#endif
+
+namespace margelo::nitro::rnmath::vmath {
+
+// Minimum elements per parallel range; smaller arrays stay on the calling thread
+static constexpr size_t MAP_CHUNK = 16384;
+
+// === SIMD PRIMITIVES ===
+// A Pack holds LANES doubles and Bits their raw 64-bit patterns. Comparisons
+// return Bits with every bit of a lane set or clear. The kernels further down
+// are written once against these functions.
+#if RNMATH_VMATH_NEON
+static constexpr size_t LANES = 2;
+using Pack = float64x2_t;
+using Bits = uint64x2_t;
+
+static inline Pack load(const double* p) { return vld1q_f64(p); }
+static inline void store(double* p, Pack a) { vst1q_f64(p, a); }
+static inline void storeBits(uint64_t* p, Bits a) { vst1q_u64(p, a); }
+static inline Pack splat(double x) { return vdupq_n_f64(x); }
+static inline Bits splatBits(uint64_t x) { return vdupq_n_u64(x); }
+static inline Pack add(Pack a, Pack b) { return vaddq_f64(a, b); }
+static inline Pack sub(Pack a, Pack b) { return vsubq_f64(a, b); }
+static inline Pack mul(Pack a, Pack b) { return vmulq_f64(a, b); }
+static inline Pack div(Pack a, Pack b) { return vdivq_f64(a, b); }
+// a * b + c, fused
+static inline Pack madd(Pack a, Pack b, Pack c) { return vfmaq_f64(c, a, b); }
+static inline Pack absolute(Pack a) { return vabsq_f64(a); }
+static inline Pack squareRoot(Pack a) { return vsqrtq_f64(a); }
+static inline Pack roundNearest(Pack a) { return vrndnq_f64(a); }
+static inline Bits lessThan(Pack a, Pack b) { return vcltq_f64(a, b); }
+static inline Bits lessEqual(Pack a, Pack b) { return vcleq_f64(a, b); }
+static inline Bits asBits(Pack a) { return vreinterpretq_u64_f64(a); }
+static inline Pack fromBits(Bits a) { return vreinterpretq_f64_u64(a); }
+static inline Bits andBits(Bits a, Bits b) { return vandq_u64(a, b); }
+static inline Bits orBits(Bits a, Bits b) { return vorrq_u64(a, b); }
+static inline Bits xorBits(Bits a, Bits b) { return veorq_u64(a, b); }
+static inline Bits addBits(Bits a, Bits b) { return vaddq_u64(a, b); }
+static inline Bits subBits(Bits a, Bits b) { return vsubq_u64(a, b); }
+template <int N> static inline Bits shiftLeft(Bits a) { return vshlq_n_u64(a, N); }
+template <int N> static inline Bits shiftRight(Bits a) { return vshrq_n_u64(a, N); }
+static inline bool allSet(Bits m) { return vminvq_u32(vreinterpretq_u32_u64(m)) == 0xFFFFFFFFu; }
+#elif RNMATH_VMATH_SSE2
+static constexpr size_t LANES = 2;
+using Pack = __m128d;
+using Bits = __m128i;
+
+static inline Pack load(const double* p) { return _mm_loadu_pd(p); }
+static inline void store(double* p, Pack a) { _mm_storeu_pd(p, a); }
+static inline void storeBits(uint64_t* p, Bits a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+static inline Pack splat(double x) { return _mm_set1_pd(x); }
+static inline Bits splatBits(uint64_t x) { return _mm_set1_epi64x(static_cast<long long>(x)); }
+static inline Pack add(Pack a, Pack b) { return _mm_add_pd(a, b); }
+static inline Pack sub(Pack a, Pack b) { return _mm_sub_pd(a, b); }
+static inline Pack mul(Pack a, Pack b) { return _mm_mul_pd(a, b); }
+static inline Pack div(Pack a, Pack b) { return _mm_div_pd(a, b); }
+// a * b + c, unfused: SSE2 has no FMA
+static inline Pack madd(Pack a, Pack b, Pack c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+static inline Pack absolute(Pack a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+static inline Pack squareRoot(Pack a) { return _mm_sqrt_pd(a); }
+// Adding and removing 1.5 * 2^52 rounds to nearest even for |a| < 2^51
+static inline Pack roundNearest(Pack a) {
+    const Pack magic = _mm_set1_pd(6755399441055744.0);
+    return _mm_sub_pd(_mm_add_pd(a, magic), magic);
+}
+static inline Bits lessThan(Pack a, Pack b) { return _mm_castpd_si128(_mm_cmplt_pd(a, b)); }
+static inline Bits lessEqual(Pack a, Pack b) { return _mm_castpd_si128(_mm_cmple_pd(a, b)); }
+static inline Bits asBits(Pack a) { return _mm_castpd_si128(a); }
+static inline Pack fromBits(Bits a) { return _mm_castsi128_pd(a); }
+static inline Bits andBits(Bits a, Bits b) { return _mm_and_si128(a, b); }
+static inline Bits orBits(Bits a, Bits b) { return _mm_or_si128(a, b); }
+static inline Bits xorBits(Bits a, Bits b) { return _mm_xor_si128(a, b); }
+static inline Bits addBits(Bits a, Bits b) { return _mm_add_epi64(a, b); }
+static inline Bits subBits(Bits a, Bits b) { return _mm_sub_epi64(a, b); }
+template <int N> static inline Bits shiftLeft(Bits a) { return _mm_slli_epi64(a, N); }
+template <int N> static inline Bits shiftRight(Bits a) { return _mm_srli_epi64(a, N); }
+static inline bool allSet(Bits m) { return _mm_movemask_pd(_mm_castsi128_pd(m)) == 0x3; }
+#else
+static constexpr size_t LANES = 1;
+using Pack = double;
+using Bits = uint64_t;
+
+static inline Pack load(const double* p) { return *p; }
+static inline void store(double* p, Pack a) { *p = a; }
+static inline void storeBits(uint64_t* p, Bits a) { *p = a; }
+static inline Pack splat(double x) { return x; }
+static inline Bits splatBits(uint64_t x) { return x; }
+static inline Pack add(Pack a, Pack b) { return a + b; }
+static inline Pack sub(Pack a, Pack b) { return a - b; }
+static inline Pack mul(Pack a, Pack b) { return a * b; }
+static inline Pack div(Pack a, Pack b) { return a / b; }
+static inline Pack madd(Pack a, Pack b, Pack c) { return a * b + c; }
+static inline Pack absolute(Pack a) { return std::fabs(a); }
+static inline Pack squareRoot(Pack a) { return std::sqrt(a); }
+static inline Pack roundNearest(Pack a) { return std::nearbyint(a); }
+static inline Bits lessThan(Pack a, Pack b) { return a < b ? ~uint64_t(0) : 0; }
+static inline Bits lessEqual(Pack a, Pack b) { return a <= b ? ~uint64_t(0) : 0; }
+static inline Bits asBits(Pack a) { Bits b; std::memcpy(&b, &a, sizeof(b)); return b; }
+static inline Pack fromBits(Bits a) { Pack p; std::memcpy(&p, &a, sizeof(p)); return p; }
+static inline Bits andBits(Bits a, Bits b) { return a & b; }
+static inline Bits orBits(Bits a, Bits b) { return a | b; }
+static inline Bits xorBits(Bits a, Bits b) { return a ^ b; }
+static inline Bits addBits(Bits a, Bits b) { return a + b; }
+static inline Bits subBits(Bits a, Bits b) { return a - b; }
+template <int N> static inline Bits shiftLeft(Bits a) { return a << N; }
+template <int N> static inline Bits shiftRight(Bits a) { return a >> N; }
+static inline bool allSet(Bits m) { return m == ~uint64_t(0); }
+#endif
+
+static inline Pack select(Bits mask, Pack a, Pack b) {
+    return fromBits(orBits(andBits(mask, asBits(a)), andBits(xorBits(mask, splatBits(~uint64_t(0))), asBits(b))));
+}
+
+static inline Pack negate(Pack a) {
+    return fromBits(xorBits(asBits(a), splatBits(uint64_t(1) << 63)));
+}
+
+// Integer-valued `a` with |a| < 2^51 to a two's complement int64 per lane
+static inline Bits toInteger(Pack a) {
+    const Pack magic = splat(6755399441055744.0);
+    return subBits(asBits(add(a, magic)), asBits(magic));
+}
+
+// Non-negative integers below 2^52 to doubles
+static inline Pack toDouble(Bits a) {
+    const Pack two52 = splat(4503599627370496.0);
+    return sub(fromBits(orBits(a, asBits(two52))), two52);
+}
+
+// All-ones lanes where bit 0 of `a` is set
+static inline Bits oddMask(Bits a) {
+    return subBits(splatBits(0), andBits(a, splatBits(1)));
+}
+
+template <size_t N>
+static inline Pack polynomial(Pack x, const double (&c)[N]) {
+    Pack r = splat(c[0]);
+    for (size_t i = 1; i < N; i++) r = madd(r, x, splat(c[i]));
+    return r;
+}
+
+// Same with an implicit leading coefficient of 1
+template <size_t N>
+static inline Pack monicPolynomial(Pack x, const double (&c)[N]) {
+    Pack r = add(x, splat(c[0]));
+    for (size_t i = 1; i < N; i++) r = madd(r, x, splat(c[i]));
+    return r;
+}
+
+// === KERNELS ===
+// Coefficients are from the Cephes Math Library (S. L. Moshier).
+
+// sin and cos on [-pi/4, pi/4]
+static const double SIN_COEFFS[] = {
+    1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+    -1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1,
+};
+static const double COS_COEFFS[] = {
+    -1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+    2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2,
+};
+// pi/2 split so that j * PIO2_1 and j * PIO2_2 are exact for the j in range
+static constexpr double PIO2_1 = 1.57079625129699707031E0;
+static constexpr double PIO2_2 = 7.54978941586159635335E-8;
+static constexpr double PIO2_3 = 5.39030285815811905290E-15;
+static constexpr double TRIG_LIMIT = 1e8;
+
+// exp(r) = 1 + 2r P(r^2) / (Q(r^2) - r P(r^2)) on [-ln(2)/2, ln(2)/2]
+static const double EXP_P[] = {
+    1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1,
+};
+static const double EXP_Q[] = {
+    3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1, 2.00000000000000000009E0,
+};
+static constexpr double LN2_HI = 6.93145751953125E-1;
+static constexpr double LN2_LO = 1.42860682030941723212E-6;
+static constexpr double EXP_LIMIT = 708.0;
+
+// log(1 + x) = x - x^2 / 2 + x^3 P(x) / Q(x) on [sqrt(1/2) - 1, sqrt(2) - 1]
+static const double LOG_P[] = {
+    1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+    1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0,
+};
+static const double LOG_Q[] = {
+    1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+    7.11544750618563894466E1, 2.31251620126765340583E1,
+};
+
+// tanh(x) = x + x^3 P(x^2) / Q(x^2) for |x| < 0.625
+static const double TANH_P[] = {
+    -9.64399179425052238628E-1, -9.92877231001918586564E1, -1.61468768441708447952E3,
+};
+static const double TANH_Q[] = {
+    1.12811678491632931402E2, 2.23548839060100448583E3, 4.84406305325125486048E3,
+};
+
+
+// Odd functions with f(x) = x to double precision below 1e-8 return x there,
+// which also keeps the sign of -0
+static inline Pack oddTiny(Pack x, Pack y) {
+    return select(lessThan(absolute(x), splat(1e-8)), x, y);
+}
+
+struct SinCos {
+    Pack sin;
+    Pack cos;
+    Bits quadrant;
+};
+
+// sin and cos of the reduced argument r = x - j * pi/2, plus j
+static inline SinCos sinCosReduced(Pack x) {
+    Pack j = roundNearest(mul(x, splat(2.0 / M_PI)));
+    Pack r = madd(j, splat(-PIO2_1), x);
+    r = madd(j, splat(-PIO2_2), r);
+    r = madd(j, splat(-PIO2_3), r);
+
+    Pack z = mul(r, r);
+    Pack s = madd(mul(r, z), polynomial(z, SIN_COEFFS), r);
+    Pack c = add(sub(splat(1.0), mul(splat(0.5), z)), mul(mul(z, z), polynomial(z, COS_COEFFS)));
+    return {s, c, toInteger(j)};
+}
+
+// Quadrant q picks +-sin or +-cos of the reduced argument: odd quadrants
+// swap them and bit 1 flips the sign
+static inline Pack fromQuadrant(const SinCos& sc, Bits q) {
+    Pack y = select(oddMask(q), sc.cos, sc.sin);
+    return fromBits(xorBits(asBits(y), shiftLeft<62>(andBits(q, splatBits(2)))));
+}
+
+struct SinKernel {
+    static Bits valid(Pack x) { return lessEqual(absolute(x), splat(TRIG_LIMIT)); }
+    static Pack eval(Pack x) {
+        SinCos sc = sinCosReduced(x);
+        return oddTiny(x, fromQuadrant(sc, sc.quadrant));
+    }
+    static double fallback(double x) { return std::sin(x); }
+};
+
+struct CosKernel {
+    static Bits valid(Pack x) { return lessEqual(absolute(x), splat(TRIG_LIMIT)); }
+    static Pack eval(Pack x) {
+        // cos(x) = sin(x + pi/2): one quadrant further
+        SinCos sc = sinCosReduced(x);
+        return fromQuadrant(sc, addBits(sc.quadrant, splatBits(1)));
+    }
+    static double fallback(double x) { return std::cos(x); }
+};
+
+struct TanKernel {
+    static Bits valid(Pack x) { return lessEqual(absolute(x), splat(TRIG_LIMIT)); }
+    static Pack eval(Pack x) {
+        // tan has period pi: tan(r) in even quadrants, -cot(r) in odd ones
+        SinCos sc = sinCosReduced(x);
+        Bits odd = oddMask(sc.quadrant);
+        return oddTiny(x, div(select(odd, negate(sc.cos), sc.sin), select(odd, sc.sin, sc.cos)));
+    }
+    static double fallback(double x) { return std::tan(x); }
+};
+
+static inline Pack expInRange(Pack x) {
+    Pack n = roundNearest(mul(x, splat(M_LOG2E)));
+    Pack r = madd(n, splat(-LN2_HI), x);
+    r = madd(n, splat(-LN2_LO), r);
+
+    Pack rr = mul(r, r);
+    Pack p = mul(r, polynomial(rr, EXP_P));
+    Pack y = div(p, sub(polynomial(rr, EXP_Q), p));
+    y = madd(splat(2.0), y, splat(1.0));
+
+    // 2^n from the exponent bits; |n| <= 1022 for |x| <= EXP_LIMIT
+    Pack scale = fromBits(shiftLeft<52>(addBits(toInteger(n), splatBits(1023))));
+    return mul(y, scale);
+}
+
+struct ExpKernel {
+    static Bits valid(Pack x) { return lessEqual(absolute(x), splat(EXP_LIMIT)); }
+    static Pack eval(Pack x) { return expInRange(x); }
+    static double fallback(double x) { return std::exp(x); }
+};
+
+// Splits a positive normal x into 2^e * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)),
+// and evaluates the rational part y of log(1 + f) = f - f^2 / 2 + y
+struct LogParts {
+    Pack e;
+    Pack f;
+    Pack f2;
+    Pack y;
+};
+
+static inline LogParts logParts(Pack x) {
+    Bits bits = asBits(x);
+    Pack e = sub(toDouble(shiftRight<52>(bits)), splat(1022.0));
+    Pack m = fromBits(orBits(andBits(bits, splatBits(0x000FFFFFFFFFFFFFull)), asBits(splat(0.5))));
+
+    // m in [0.5, 1): below sqrt(1/2), use 2m and one less in the exponent
+    Bits low = lessThan(m, splat(M_SQRT1_2));
+    e = sub(e, fromBits(andBits(low, asBits(splat(1.0)))));
+    Pack f = sub(select(low, add(m, m), m), splat(1.0));
+
+    Pack f2 = mul(f, f);
+    Pack y = mul(f, div(mul(f2, polynomial(f, LOG_P)), monicPolynomial(f, LOG_Q)));
+    return {e, f, f2, y};
+}
+
+static inline Bits positiveNormal(Pack x) {
+    return andBits(lessEqual(splat(std::numeric_limits<double>::min()), x),
+                   lessEqual(x, splat(std::numeric_limits<double>::max())));
+}
+
+struct LogKernel {
+    static Bits valid(Pack x) { return positiveNormal(x); }
+    static Pack eval(Pack x) {
+        // ln(2) = 0.693359375 - 2.121944400546905827679e-4, the first part exact in e * ln(2)
+        LogParts p = logParts(x);
+        Pack y = madd(p.e, splat(-2.121944400546905827679e-4), p.y);
+        y = madd(splat(-0.5), p.f2, y);
+        return madd(p.e, splat(0.693359375), add(p.f, y));
+    }
+    static double fallback(double x) { return std::log(x); }
+};
+
+struct Log2Kernel {
+    static Bits valid(Pack x) { return positiveNormal(x); }
+    static Pack eval(Pack x) {
+        // log2(e) = 1 + LOG2EA, so the largest terms are added without rounding the factor
+        constexpr double LOG2EA = 0.44269504088896340735992;
+        LogParts p = logParts(x);
+        Pack y = madd(splat(-0.5), p.f2, p.y);
+        Pack z = mul(y, splat(LOG2EA));
+        z = madd(p.f, splat(LOG2EA), z);
+        z = add(z, y);
+        z = add(z, p.f);
+        return add(z, p.e);
+    }
+    static double fallback(double x) { return std::log2(x); }
+};
+
+struct Log10Kernel {
+    static Bits valid(Pack x) { return positiveNormal(x); }
+    static Pack eval(Pack x) {
+        // log10(e) and log10(2) split into a short exact head and a tail,
+        // accumulated from the smallest term up
+        constexpr double L10EA = 4.3359375E-1, L10EB = 7.00731903251827651129E-4;
+        constexpr double L102A = 3.0078125E-1, L102B = 2.48745663981195213739E-4;
+        LogParts p = logParts(x);
+        Pack y = madd(splat(-0.5), p.f2, p.y);
+        Pack z = mul(add(p.f, y), splat(L10EB));
+        z = madd(p.e, splat(L102B), z);
+        z = madd(y, splat(L10EA), z);
+        z = madd(p.f, splat(L10EA), z);
+        return madd(p.e, splat(L102A), z);
+    }
+    static double fallback(double x) { return std::log10(x); }
+};
+
+struct TanhKernel {
+    static Bits valid(Pack x) { return lessEqual(absolute(x), splat(std::numeric_limits<double>::infinity())); }
+    static Pack eval(Pack x) {
+        Pack ax = absolute(x);
+        Pack s = mul(x, x);
+        Pack small = madd(mul(x, s), div(polynomial(s, TANH_P), monicPolynomial(s, TANH_Q)), x);
+
+        // 1 - 2 / (exp(2|x|) + 1), which rounds to 1 beyond |x| = 22
+        Pack e = expInRange(mul(splat(2.0), select(lessThan(ax, splat(22.0)), ax, splat(22.0))));
+        Pack large = sub(splat(1.0), div(splat(2.0), add(e, splat(1.0))));
+        large = fromBits(orBits(asBits(large), andBits(asBits(x), splatBits(uint64_t(1) << 63))));
+        return oddTiny(x, select(lessThan(ax, splat(0.625)), small, large));
+    }
+    static double fallback(double x) { return std::tanh(x); }
+};
+
+struct SqrtKernel {
+    static Bits valid(Pack) { return splatBits(~uint64_t(0)); }
+    static Pack eval(Pack x) { return squareRoot(x); }
+    static double fallback(double x) { return std::sqrt(x); }
+};
+
+struct AbsKernel {
+    static Bits valid(Pack) { return splatBits(~uint64_t(0)); }
+    static Pack eval(Pack x) { return absolute(x); }
+    static double fallback(double x) { return std::fabs(x); }
+};
+
+// === DRIVERS ===
+template <typename Kernel>
+static void mapRange(const double* in, double* out, size_t n) {
+    size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        Pack x = load(in + i);
+        Bits ok = Kernel::valid(x);
+        Pack y = Kernel::eval(x);
+        if (allSet(ok)) {
+            store(out + i, y);
+            continue;
+        }
+
+        // Recompute out-of-range lanes with the C library; the inputs are
+        // saved first because `out` may alias `in`
+        double xs[LANES];
+        uint64_t flags[LANES];
+        store(xs, x);
+        storeBits(flags, ok);
+        store(out + i, y);
+        for (size_t l = 0; l < LANES; l++) {
+            if (!flags[l]) out[i + l] = Kernel::fallback(xs[l]);
+        }
+    }
+
+    if (i < n) {
+        // Pad the tail with a value inside every kernel's domain
+        double xs[LANES];
+        double ys[LANES];
+        std::fill(xs, xs + LANES, 1.0);
+        std::copy(in + i, in + n, xs);
+        mapRange<Kernel>(xs, ys, LANES);
+        std::copy(ys, ys + (n - i), out + i);
+    }
+}
+
+template <typename Fn>
+static void forRanges(size_t n, const Fn& fn) {
+    ThreadPool& pool = ThreadPool::shared();
+    pool.parallelFor(n, pool.grainFor(n, MAP_CHUNK), fn);
+}
+
+template <typename Kernel>
+static void mapKernel(const double* in, double* out, size_t n) {
+    forRanges(n, [&](size_t begin, size_t end) { mapRange<Kernel>(in + begin, out + begin, end - begin); });
+}
+
+template <typename F>
+static void mapScalar(const double* in, double* out, size_t n, F f) {
+    forRanges(n, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) out[i] = f(in[i]);
+    });
+}
+
+void map(Function function, const double* in, double* out, size_t n) {
+    switch (function) {
+        case Function::Sin: return mapKernel<SinKernel>(in, out, n);
+        case Function::Cos: return mapKernel<CosKernel>(in, out, n);
+        case Function::Tan: return mapKernel<TanKernel>(in, out, n);
+        case Function::Asin: return mapScalar(in, out, n, [](double x) { return std::asin(x); });
+        case Function::Acos: return mapScalar(in, out, n, [](double x) { return std::acos(x); });
+        case Function::Atan: return mapScalar(in, out, n, [](double x) { return std::atan(x); });
+        case Function::Sinh: return mapScalar(in, out, n, [](double x) { return std::sinh(x); });
+        case Function::Cosh: return mapScalar(in, out, n, [](double x) { return std::cosh(x); });
+        case Function::Tanh: return mapKernel<TanhKernel>(in, out, n);
+        case Function::Exp: return mapKernel<ExpKernel>(in, out, n);
+        case Function::Log: return mapKernel<LogKernel>(in, out, n);
+        case Function::Log2: return mapKernel<Log2Kernel>(in, out, n);
+        case Function::Log10: return mapKernel<Log10Kernel>(in, out, n);
+        case Function::Sqrt: return mapKernel<SqrtKernel>(in, out, n);
+        case Function::Abs: return mapKernel<AbsKernel>(in, out, n);
+        case Function::Erf: return mapScalar(in, out, n, [](double x) { return std::erf(x); });
+        case Function::Erfc: return mapScalar(in, out, n, [](double x) { return std::erfc(x); });
+        case Function::Gamma: return mapScalar(in, out, n, [](double x) { return std::tgamma(x); });
+    }
+}
+
+void power(const double* in, double exponent, double* out, size_t n) {
+    if (exponent == 1.0) {
+        if (out != in) std::copy(in, in + n, out);
+    } else if (exponent == 2.0) {
+        mapScalar(in, out, n, [](double x) { return x * x; });
+    } else if (exponent == 0.5) {
+        // pow(-0, 0.5) is +0 and pow(-inf, 0.5) is +inf, unlike sqrt
+        mapScalar(in, out, n, [](double x) { return x == 0.0 || std::isinf(x) ? std::fabs(x) : std::sqrt(x); });
+    } else if (exponent == -1.0) {
+        mapScalar(in, out, n, [](double x) { return 1.0 / x; });
+    } else {
+        mapScalar(in, out, n, [exponent](double x) { return std::pow(x, exponent); });
+    }
+}
+
+} // namespace margelo::nitro::rnmath::vmath
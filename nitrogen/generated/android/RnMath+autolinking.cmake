@@ -34,6 +34,15 @@ target_sources(
   ../nitrogen/generated/android/RnMathOnLoad.cpp
   # Shared Nitrogen C++ sources
   ../nitrogen/generated/shared/c++/HybridMathSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridFFTPlanSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridFilterSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridFactorizationSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridOnlineRegressionSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridNeuralNetworkSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridExpressionSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridNativeArraySpec.cpp
+  ../nitrogen/generated/shared/c++/HybridRandomGeneratorSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridDistributionSpec.cpp
   # Android-specific Nitrogen C++ sources
   
 )
@@ -0,0 +1,90 @@
+///
+/// Activation.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (Activation).
+   */
+  enum class Activation {
+    LINEAR      SWIFT_NAME(linear) = 0,
+    RELU      SWIFT_NAME(relu) = 1,
+    TANH      SWIFT_NAME(tanh) = 2,
+    SIGMOID      SWIFT_NAME(sigmoid) = 3,
+    SOFTMAX      SWIFT_NAME(softmax) = 4,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ Activation <> JS Activation (union)
+  template <>
+  struct JSIConverter<Activation> final {
+    static inline Activation fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("linear"): return Activation::LINEAR;
+        case hashString("relu"): return Activation::RELU;
+        case hashString("tanh"): return Activation::TANH;
+        case hashString("sigmoid"): return Activation::SIGMOID;
+        case hashString("softmax"): return Activation::SOFTMAX;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum Activation - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, Activation arg) {
+      switch (arg) {
+        case Activation::LINEAR: return JSIConverter<std::string>::toJSI(runtime, "linear");
+        case Activation::RELU: return JSIConverter<std::string>::toJSI(runtime, "relu");
+        case Activation::TANH: return JSIConverter<std::string>::toJSI(runtime, "tanh");
+        case Activation::SIGMOID: return JSIConverter<std::string>::toJSI(runtime, "sigmoid");
+        case Activation::SOFTMAX: return JSIConverter<std::string>::toJSI(runtime, "softmax");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert Activation to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("linear"):
+        case hashString("relu"):
+        case hashString("tanh"):
+        case hashString("sigmoid"):
+        case hashString("softmax"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,86 @@
+///
+/// ConvolutionMode.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (ConvolutionMode).
+   */
+  enum class ConvolutionMode {
+    AUTO      SWIFT_NAME(auto) = 0,
+    DIRECT      SWIFT_NAME(direct) = 1,
+    FFT      SWIFT_NAME(fft) = 2,
+    OVERLAPADD      SWIFT_NAME(overlapadd) = 3,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ ConvolutionMode <> JS ConvolutionMode (union)
+  template <>
+  struct JSIConverter<ConvolutionMode> final {
+    static inline ConvolutionMode fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("auto"): return ConvolutionMode::AUTO;
+        case hashString("direct"): return ConvolutionMode::DIRECT;
+        case hashString("fft"): return ConvolutionMode::FFT;
+        case hashString("overlapAdd"): return ConvolutionMode::OVERLAPADD;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ConvolutionMode - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, ConvolutionMode arg) {
+      switch (arg) {
+        case ConvolutionMode::AUTO: return JSIConverter<std::string>::toJSI(runtime, "auto");
+        case ConvolutionMode::DIRECT: return JSIConverter<std::string>::toJSI(runtime, "direct");
+        case ConvolutionMode::FFT: return JSIConverter<std::string>::toJSI(runtime, "fft");
+        case ConvolutionMode::OVERLAPADD: return JSIConverter<std::string>::toJSI(runtime, "overlapAdd");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert ConvolutionMode to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("auto"):
+        case hashString("direct"):
+        case hashString("fft"):
+        case hashString("overlapAdd"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,78 @@
+///
+/// DType.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (DType).
+   */
+  enum class DType {
+    FLOAT64      SWIFT_NAME(float64) = 0,
+    FLOAT32      SWIFT_NAME(float32) = 1,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ DType <> JS DType (union)
+  template <>
+  struct JSIConverter<DType> final {
+    static inline DType fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("float64"): return DType::FLOAT64;
+        case hashString("float32"): return DType::FLOAT32;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum DType - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, DType arg) {
+      switch (arg) {
+        case DType::FLOAT64: return JSIConverter<std::string>::toJSI(runtime, "float64");
+        case DType::FLOAT32: return JSIConverter<std::string>::toJSI(runtime, "float32");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert DType to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("float64"):
+        case hashString("float32"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
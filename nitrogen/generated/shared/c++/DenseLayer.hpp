@@ -0,0 +1,79 @@
+///
+/// DenseLayer.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `Activation` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class Activation; }
+
+#include <vector>
+#include "Activation.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DenseLayer).
+   */
+  struct DenseLayer {
+  public:
+    std::vector<std::vector<double>> weights     SWIFT_PRIVATE;
+    std::vector<double> bias     SWIFT_PRIVATE;
+    Activation activation     SWIFT_PRIVATE;
+
+  public:
+    DenseLayer() = default;
+    explicit DenseLayer(std::vector<std::vector<double>> weights, std::vector<double> bias, Activation activation): weights(weights), bias(bias), activation(activation) {}
+  };
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ DenseLayer <> JS DenseLayer (object)
+  template <>
+  struct JSIConverter<DenseLayer> final {
+    static inline DenseLayer fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return DenseLayer(
+        JSIConverter<std::vector<std::vector<double>>>::fromJSI(runtime, obj.getProperty(runtime, "weights")),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, "bias")),
+        JSIConverter<Activation>::fromJSI(runtime, obj.getProperty(runtime, "activation"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const DenseLayer& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "weights", JSIConverter<std::vector<std::vector<double>>>::toJSI(runtime, arg.weights));
+      obj.setProperty(runtime, "bias", JSIConverter<std::vector<double>>::toJSI(runtime, arg.bias));
+      obj.setProperty(runtime, "activation", JSIConverter<Activation>::toJSI(runtime, arg.activation));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::vector<std::vector<double>>>::canConvert(runtime, obj.getProperty(runtime, "weights"))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, "bias"))) return false;
+      if (!JSIConverter<Activation>::canConvert(runtime, obj.getProperty(runtime, "activation"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
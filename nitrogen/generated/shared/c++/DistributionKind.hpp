@@ -0,0 +1,106 @@
+///
+/// DistributionKind.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (DistributionKind).
+   */
+  enum class DistributionKind {
+    NORMAL      SWIFT_NAME(normal) = 0,
+    LOGNORMAL      SWIFT_NAME(lognormal) = 1,
+    EXPONENTIAL      SWIFT_NAME(exponential) = 2,
+    GAMMA      SWIFT_NAME(gamma) = 3,
+    BETA      SWIFT_NAME(beta) = 4,
+    STUDENTT      SWIFT_NAME(studentt) = 5,
+    CHISQUARED      SWIFT_NAME(chisquared) = 6,
+    POISSON      SWIFT_NAME(poisson) = 7,
+    BINOMIAL      SWIFT_NAME(binomial) = 8,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ DistributionKind <> JS DistributionKind (union)
+  template <>
+  struct JSIConverter<DistributionKind> final {
+    static inline DistributionKind fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("normal"): return DistributionKind::NORMAL;
+        case hashString("lognormal"): return DistributionKind::LOGNORMAL;
+        case hashString("exponential"): return DistributionKind::EXPONENTIAL;
+        case hashString("gamma"): return DistributionKind::GAMMA;
+        case hashString("beta"): return DistributionKind::BETA;
+        case hashString("studentT"): return DistributionKind::STUDENTT;
+        case hashString("chiSquared"): return DistributionKind::CHISQUARED;
+        case hashString("poisson"): return DistributionKind::POISSON;
+        case hashString("binomial"): return DistributionKind::BINOMIAL;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum DistributionKind - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, DistributionKind arg) {
+      switch (arg) {
+        case DistributionKind::NORMAL: return JSIConverter<std::string>::toJSI(runtime, "normal");
+        case DistributionKind::LOGNORMAL: return JSIConverter<std::string>::toJSI(runtime, "lognormal");
+        case DistributionKind::EXPONENTIAL: return JSIConverter<std::string>::toJSI(runtime, "exponential");
+        case DistributionKind::GAMMA: return JSIConverter<std::string>::toJSI(runtime, "gamma");
+        case DistributionKind::BETA: return JSIConverter<std::string>::toJSI(runtime, "beta");
+        case DistributionKind::STUDENTT: return JSIConverter<std::string>::toJSI(runtime, "studentT");
+        case DistributionKind::CHISQUARED: return JSIConverter<std::string>::toJSI(runtime, "chiSquared");
+        case DistributionKind::POISSON: return JSIConverter<std::string>::toJSI(runtime, "poisson");
+        case DistributionKind::BINOMIAL: return JSIConverter<std::string>::toJSI(runtime, "binomial");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert DistributionKind to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("normal"):
+        case hashString("lognormal"):
+        case hashString("exponential"):
+        case hashString("gamma"):
+        case hashString("beta"):
+        case hashString("studentT"):
+        case hashString("chiSquared"):
+        case hashString("poisson"):
+        case hashString("binomial"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,142 @@
+///
+/// ElementwiseFunction.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (ElementwiseFunction).
+   */
+  enum class ElementwiseFunction {
+    SIN      SWIFT_NAME(sin) = 0,
+    COS      SWIFT_NAME(cos) = 1,
+    TAN      SWIFT_NAME(tan) = 2,
+    ASIN      SWIFT_NAME(asin) = 3,
+    ACOS      SWIFT_NAME(acos) = 4,
+    ATAN      SWIFT_NAME(atan) = 5,
+    SINH      SWIFT_NAME(sinh) = 6,
+    COSH      SWIFT_NAME(cosh) = 7,
+    TANH      SWIFT_NAME(tanh) = 8,
+    EXP      SWIFT_NAME(exp) = 9,
+    LOG      SWIFT_NAME(log) = 10,
+    LOG2      SWIFT_NAME(log2) = 11,
+    LOG10      SWIFT_NAME(log10) = 12,
+    SQRT      SWIFT_NAME(sqrt) = 13,
+    ABS      SWIFT_NAME(abs) = 14,
+    ERF      SWIFT_NAME(erf) = 15,
+    ERFC      SWIFT_NAME(erfc) = 16,
+    GAMMA      SWIFT_NAME(gamma) = 17,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ ElementwiseFunction <> JS ElementwiseFunction (union)
+  template <>
+  struct JSIConverter<ElementwiseFunction> final {
+    static inline ElementwiseFunction fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("sin"): return ElementwiseFunction::SIN;
+        case hashString("cos"): return ElementwiseFunction::COS;
+        case hashString("tan"): return ElementwiseFunction::TAN;
+        case hashString("asin"): return ElementwiseFunction::ASIN;
+        case hashString("acos"): return ElementwiseFunction::ACOS;
+        case hashString("atan"): return ElementwiseFunction::ATAN;
+        case hashString("sinh"): return ElementwiseFunction::SINH;
+        case hashString("cosh"): return ElementwiseFunction::COSH;
+        case hashString("tanh"): return ElementwiseFunction::TANH;
+        case hashString("exp"): return ElementwiseFunction::EXP;
+        case hashString("log"): return ElementwiseFunction::LOG;
+        case hashString("log2"): return ElementwiseFunction::LOG2;
+        case hashString("log10"): return ElementwiseFunction::LOG10;
+        case hashString("sqrt"): return ElementwiseFunction::SQRT;
+        case hashString("abs"): return ElementwiseFunction::ABS;
+        case hashString("erf"): return ElementwiseFunction::ERF;
+        case hashString("erfc"): return ElementwiseFunction::ERFC;
+        case hashString("gamma"): return ElementwiseFunction::GAMMA;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ElementwiseFunction - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, ElementwiseFunction arg) {
+      switch (arg) {
+        case ElementwiseFunction::SIN: return JSIConverter<std::string>::toJSI(runtime, "sin");
+        case ElementwiseFunction::COS: return JSIConverter<std::string>::toJSI(runtime, "cos");
+        case ElementwiseFunction::TAN: return JSIConverter<std::string>::toJSI(runtime, "tan");
+        case ElementwiseFunction::ASIN: return JSIConverter<std::string>::toJSI(runtime, "asin");
+        case ElementwiseFunction::ACOS: return JSIConverter<std::string>::toJSI(runtime, "acos");
+        case ElementwiseFunction::ATAN: return JSIConverter<std::string>::toJSI(runtime, "atan");
+        case ElementwiseFunction::SINH: return JSIConverter<std::string>::toJSI(runtime, "sinh");
+        case ElementwiseFunction::COSH: return JSIConverter<std::string>::toJSI(runtime, "cosh");
+        case ElementwiseFunction::TANH: return JSIConverter<std::string>::toJSI(runtime, "tanh");
+        case ElementwiseFunction::EXP: return JSIConverter<std::string>::toJSI(runtime, "exp");
+        case ElementwiseFunction::LOG: return JSIConverter<std::string>::toJSI(runtime, "log");
+        case ElementwiseFunction::LOG2: return JSIConverter<std::string>::toJSI(runtime, "log2");
+        case ElementwiseFunction::LOG10: return JSIConverter<std::string>::toJSI(runtime, "log10");
+        case ElementwiseFunction::SQRT: return JSIConverter<std::string>::toJSI(runtime, "sqrt");
+        case ElementwiseFunction::ABS: return JSIConverter<std::string>::toJSI(runtime, "abs");
+        case ElementwiseFunction::ERF: return JSIConverter<std::string>::toJSI(runtime, "erf");
+        case ElementwiseFunction::ERFC: return JSIConverter<std::string>::toJSI(runtime, "erfc");
+        case ElementwiseFunction::GAMMA: return JSIConverter<std::string>::toJSI(runtime, "gamma");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert ElementwiseFunction to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("sin"):
+        case hashString("cos"):
+        case hashString("tan"):
+        case hashString("asin"):
+        case hashString("acos"):
+        case hashString("atan"):
+        case hashString("sinh"):
+        case hashString("cosh"):
+        case hashString("tanh"):
+        case hashString("exp"):
+        case hashString("log"):
+        case hashString("log2"):
+        case hashString("log10"):
+        case hashString("sqrt"):
+        case hashString("abs"):
+        case hashString("erf"):
+        case hashString("erfc"):
+        case hashString("gamma"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
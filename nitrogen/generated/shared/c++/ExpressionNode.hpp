@@ -0,0 +1,90 @@
+///
+/// ExpressionNode.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ExpressionOp` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ExpressionOp; }
+// Forward declaration of `ElementwiseFunction` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ElementwiseFunction; }
+
+#include "ExpressionOp.hpp"
+#include <optional>
+#include "ElementwiseFunction.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ExpressionNode).
+   */
+  struct ExpressionNode {
+  public:
+    ExpressionOp op     SWIFT_PRIVATE;
+    std::optional<double> a     SWIFT_PRIVATE;
+    std::optional<double> b     SWIFT_PRIVATE;
+    std::optional<double> value     SWIFT_PRIVATE;
+    std::optional<ElementwiseFunction> fn     SWIFT_PRIVATE;
+
+  public:
+    ExpressionNode() = default;
+    explicit ExpressionNode(ExpressionOp op, std::optional<double> a, std::optional<double> b, std::optional<double> value, std::optional<ElementwiseFunction> fn): op(op), a(a), b(b), value(value), fn(fn) {}
+  };
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ ExpressionNode <> JS ExpressionNode (object)
+  template <>
+  struct JSIConverter<ExpressionNode> final {
+    static inline ExpressionNode fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return ExpressionNode(
+        JSIConverter<ExpressionOp>::fromJSI(runtime, obj.getProperty(runtime, "op")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "a")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "b")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "value")),
+        JSIConverter<std::optional<ElementwiseFunction>>::fromJSI(runtime, obj.getProperty(runtime, "fn"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const ExpressionNode& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "op", JSIConverter<ExpressionOp>::toJSI(runtime, arg.op));
+      obj.setProperty(runtime, "a", JSIConverter<std::optional<double>>::toJSI(runtime, arg.a));
+      obj.setProperty(runtime, "b", JSIConverter<std::optional<double>>::toJSI(runtime, arg.b));
+      obj.setProperty(runtime, "value", JSIConverter<std::optional<double>>::toJSI(runtime, arg.value));
+      obj.setProperty(runtime, "fn", JSIConverter<std::optional<ElementwiseFunction>>::toJSI(runtime, arg.fn));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<ExpressionOp>::canConvert(runtime, obj.getProperty(runtime, "op"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "a"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "b"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "value"))) return false;
+      if (!JSIConverter<std::optional<ElementwiseFunction>>::canConvert(runtime, obj.getProperty(runtime, "fn"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,114 @@
+///
+/// ExpressionOp.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (ExpressionOp).
+   */
+  enum class ExpressionOp {
+    INPUT      SWIFT_NAME(input) = 0,
+    CONSTANT      SWIFT_NAME(constant) = 1,
+    ADD      SWIFT_NAME(add) = 2,
+    SUB      SWIFT_NAME(sub) = 3,
+    MUL      SWIFT_NAME(mul) = 4,
+    DIV      SWIFT_NAME(div) = 5,
+    MIN      SWIFT_NAME(min) = 6,
+    MAX      SWIFT_NAME(max) = 7,
+    NEG      SWIFT_NAME(neg) = 8,
+    MAP      SWIFT_NAME(map) = 9,
+    POW      SWIFT_NAME(pow) = 10,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ ExpressionOp <> JS ExpressionOp (union)
+  template <>
+  struct JSIConverter<ExpressionOp> final {
+    static inline ExpressionOp fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("input"): return ExpressionOp::INPUT;
+        case hashString("constant"): return ExpressionOp::CONSTANT;
+        case hashString("add"): return ExpressionOp::ADD;
+        case hashString("sub"): return ExpressionOp::SUB;
+        case hashString("mul"): return ExpressionOp::MUL;
+        case hashString("div"): return ExpressionOp::DIV;
+        case hashString("min"): return ExpressionOp::MIN;
+        case hashString("max"): return ExpressionOp::MAX;
+        case hashString("neg"): return ExpressionOp::NEG;
+        case hashString("map"): return ExpressionOp::MAP;
+        case hashString("pow"): return ExpressionOp::POW;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ExpressionOp - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, ExpressionOp arg) {
+      switch (arg) {
+        case ExpressionOp::INPUT: return JSIConverter<std::string>::toJSI(runtime, "input");
+        case ExpressionOp::CONSTANT: return JSIConverter<std::string>::toJSI(runtime, "constant");
+        case ExpressionOp::ADD: return JSIConverter<std::string>::toJSI(runtime, "add");
+        case ExpressionOp::SUB: return JSIConverter<std::string>::toJSI(runtime, "sub");
+        case ExpressionOp::MUL: return JSIConverter<std::string>::toJSI(runtime, "mul");
+        case ExpressionOp::DIV: return JSIConverter<std::string>::toJSI(runtime, "div");
+        case ExpressionOp::MIN: return JSIConverter<std::string>::toJSI(runtime, "min");
+        case ExpressionOp::MAX: return JSIConverter<std::string>::toJSI(runtime, "max");
+        case ExpressionOp::NEG: return JSIConverter<std::string>::toJSI(runtime, "neg");
+        case ExpressionOp::MAP: return JSIConverter<std::string>::toJSI(runtime, "map");
+        case ExpressionOp::POW: return JSIConverter<std::string>::toJSI(runtime, "pow");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert ExpressionOp to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("input"):
+        case hashString("constant"):
+        case hashString("add"):
+        case hashString("sub"):
+        case hashString("mul"):
+        case hashString("div"):
+        case hashString("min"):
+        case hashString("max"):
+        case hashString("neg"):
+        case hashString("map"):
+        case hashString("pow"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,90 @@
+///
+/// ExpressionReduction.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (ExpressionReduction).
+   */
+  enum class ExpressionReduction {
+    SUM      SWIFT_NAME(sum) = 0,
+    MEAN      SWIFT_NAME(mean) = 1,
+    MIN      SWIFT_NAME(min) = 2,
+    MAX      SWIFT_NAME(max) = 3,
+    NORM      SWIFT_NAME(norm) = 4,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ ExpressionReduction <> JS ExpressionReduction (union)
+  template <>
+  struct JSIConverter<ExpressionReduction> final {
+    static inline ExpressionReduction fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("sum"): return ExpressionReduction::SUM;
+        case hashString("mean"): return ExpressionReduction::MEAN;
+        case hashString("min"): return ExpressionReduction::MIN;
+        case hashString("max"): return ExpressionReduction::MAX;
+        case hashString("norm"): return ExpressionReduction::NORM;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum ExpressionReduction - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, ExpressionReduction arg) {
+      switch (arg) {
+        case ExpressionReduction::SUM: return JSIConverter<std::string>::toJSI(runtime, "sum");
+        case ExpressionReduction::MEAN: return JSIConverter<std::string>::toJSI(runtime, "mean");
+        case ExpressionReduction::MIN: return JSIConverter<std::string>::toJSI(runtime, "min");
+        case ExpressionReduction::MAX: return JSIConverter<std::string>::toJSI(runtime, "max");
+        case ExpressionReduction::NORM: return JSIConverter<std::string>::toJSI(runtime, "norm");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert ExpressionReduction to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("sum"):
+        case hashString("mean"):
+        case hashString("min"):
+        case hashString("max"):
+        case hashString("norm"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,82 @@
+///
+/// FactorizationKind.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/NitroHash.hpp>)
+#include <NitroModules/NitroHash.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * An enum which can be represented as a JavaScript union (FactorizationKind).
+   */
+  enum class FactorizationKind {
+    LU      SWIFT_NAME(lu) = 0,
+    CHOLESKY      SWIFT_NAME(cholesky) = 1,
+    QR      SWIFT_NAME(qr) = 2,
+  } CLOSED_ENUM;
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ FactorizationKind <> JS FactorizationKind (union)
+  template <>
+  struct JSIConverter<FactorizationKind> final {
+    static inline FactorizationKind fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, arg);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("lu"): return FactorizationKind::LU;
+        case hashString("cholesky"): return FactorizationKind::CHOLESKY;
+        case hashString("qr"): return FactorizationKind::QR;
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert \"" + unionValue + "\" to enum FactorizationKind - invalid value!");
+      }
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, FactorizationKind arg) {
+      switch (arg) {
+        case FactorizationKind::LU: return JSIConverter<std::string>::toJSI(runtime, "lu");
+        case FactorizationKind::CHOLESKY: return JSIConverter<std::string>::toJSI(runtime, "cholesky");
+        case FactorizationKind::QR: return JSIConverter<std::string>::toJSI(runtime, "qr");
+        default: [[unlikely]]
+          throw std::invalid_argument("Cannot convert FactorizationKind to JS - invalid value: "
+                                    + std::to_string(static_cast<int>(arg)) + "!");
+      }
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isString()) {
+        return false;
+      }
+      std::string unionValue = JSIConverter<std::string>::fromJSI(runtime, value);
+      switch (hashString(unionValue.c_str(), unionValue.size())) {
+        case hashString("lu"):
+        case hashString("cholesky"):
+        case hashString("qr"):
+          return true;
+        default:
+          return false;
+      }
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,32 @@
+///
+/// HybridDistributionSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridDistributionSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridDistributionSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("kind", &HybridDistributionSpec::getKind);
+      prototype.registerHybridGetter("params", &HybridDistributionSpec::getParams);
+      prototype.registerHybridGetter("mean", &HybridDistributionSpec::getMean);
+      prototype.registerHybridGetter("variance", &HybridDistributionSpec::getVariance);
+      prototype.registerHybridMethod("pdf", &HybridDistributionSpec::pdf);
+      prototype.registerHybridMethod("cdf", &HybridDistributionSpec::cdf);
+      prototype.registerHybridMethod("quantile", &HybridDistributionSpec::quantile);
+      prototype.registerHybridMethod("pdfBuffer", &HybridDistributionSpec::pdfBuffer);
+      prototype.registerHybridMethod("cdfBuffer", &HybridDistributionSpec::cdfBuffer);
+      prototype.registerHybridMethod("quantileBuffer", &HybridDistributionSpec::quantileBuffer);
+      prototype.registerHybridMethod("sample", &HybridDistributionSpec::sample);
+      prototype.registerHybridMethod("sampleBuffer", &HybridDistributionSpec::sampleBuffer);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
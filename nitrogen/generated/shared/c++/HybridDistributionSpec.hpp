@@ -0,0 +1,80 @@
+///
+/// HybridDistributionSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `DistributionKind` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class DistributionKind; }
+// Forward declaration of `HybridRandomGeneratorSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridRandomGeneratorSpec; }
+
+#include "DistributionKind.hpp"
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+#include <memory>
+#include "HybridRandomGeneratorSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `Distribution`
+   * Inherit this class to create instances of `HybridDistributionSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridDistribution: public HybridDistributionSpec {
+   * public:
+   *   HybridDistribution(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridDistributionSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridDistributionSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridDistributionSpec() override = default;
+
+    public:
+      // Properties
+      virtual DistributionKind getKind() = 0;
+      virtual std::vector<double> getParams() = 0;
+      virtual double getMean() = 0;
+      virtual double getVariance() = 0;
+
+    public:
+      // Methods
+      virtual std::vector<double> pdf(const std::vector<double>& x) = 0;
+      virtual std::vector<double> cdf(const std::vector<double>& x) = 0;
+      virtual std::vector<double> quantile(const std::vector<double>& p) = 0;
+      virtual std::shared_ptr<ArrayBuffer> pdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> cdfBuffer(const std::shared_ptr<ArrayBuffer>& x, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> quantileBuffer(const std::shared_ptr<ArrayBuffer>& p, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::vector<double> sample(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count) = 0;
+      virtual std::shared_ptr<ArrayBuffer> sampleBuffer(const std::shared_ptr<HybridRandomGeneratorSpec>& generator, double count, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "Distribution";
+  };
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,26 @@
+///
+/// HybridExpressionSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridExpressionSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridExpressionSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("inputs", &HybridExpressionSpec::getInputs);
+      prototype.registerHybridGetter("nodes", &HybridExpressionSpec::getNodes);
+      prototype.registerHybridMethod("evaluate", &HybridExpressionSpec::evaluate);
+      prototype.registerHybridMethod("evaluateBuffer", &HybridExpressionSpec::evaluateBuffer);
+      prototype.registerHybridMethod("reduce", &HybridExpressionSpec::reduce);
+      prototype.registerHybridMethod("reduceBuffer", &HybridExpressionSpec::reduceBuffer);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,70 @@
+///
+/// HybridExpressionSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ExpressionReduction` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ExpressionReduction; }
+
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+#include "ExpressionReduction.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `Expression`
+   * Inherit this class to create instances of `HybridExpressionSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridExpression: public HybridExpressionSpec {
+   * public:
+   *   HybridExpression(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridExpressionSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridExpressionSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridExpressionSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getInputs() = 0;
+      virtual double getNodes() = 0;
+
+    public:
+      // Methods
+      virtual std::vector<double> evaluate(const std::vector<std::vector<double>>& inputs) = 0;
+      virtual std::shared_ptr<ArrayBuffer> evaluateBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual double reduce(const std::vector<std::vector<double>>& inputs, ExpressionReduction reduction) = 0;
+      virtual double reduceBuffer(const std::vector<std::shared_ptr<ArrayBuffer>>& inputs, ExpressionReduction reduction) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "Expression";
+  };
+
+} // namespace margelo::nitro::rnmath
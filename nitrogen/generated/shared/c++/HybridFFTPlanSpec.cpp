@@ -0,0 +1,24 @@
+///
+/// HybridFFTPlanSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridFFTPlanSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridFFTPlanSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("size", &HybridFFTPlanSpec::getSize);
+      prototype.registerHybridGetter("inverse", &HybridFFTPlanSpec::getInverse);
+      prototype.registerHybridMethod("execute", &HybridFFTPlanSpec::execute);
+      prototype.registerHybridMethod("executeBuffer", &HybridFFTPlanSpec::executeBuffer);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,67 @@
+///
+/// HybridFFTPlanSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <tuple>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `FFTPlan`
+   * Inherit this class to create instances of `HybridFFTPlanSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridFFTPlan: public HybridFFTPlanSpec {
+   * public:
+   *   HybridFFTPlan(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridFFTPlanSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridFFTPlanSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridFFTPlanSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getSize() = 0;
+      virtual bool getInverse() = 0;
+
+    public:
+      // Methods
+      virtual std::tuple<std::vector<double>, std::vector<double>> execute(const std::vector<double>& real, const std::vector<double>& imag) = 0;
+      virtual std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> executeBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "FFTPlan";
+  };
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,27 @@
+///
+/// HybridFactorizationSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridFactorizationSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridFactorizationSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("kind", &HybridFactorizationSpec::getKind);
+      prototype.registerHybridGetter("rows", &HybridFactorizationSpec::getRows);
+      prototype.registerHybridGetter("cols", &HybridFactorizationSpec::getCols);
+      prototype.registerHybridMethod("solve", &HybridFactorizationSpec::solve);
+      prototype.registerHybridMethod("solveMany", &HybridFactorizationSpec::solveMany);
+      prototype.registerHybridMethod("solveBuffer", &HybridFactorizationSpec::solveBuffer);
+      prototype.registerHybridMethod("determinant", &HybridFactorizationSpec::determinant);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,71 @@
+///
+/// HybridFactorizationSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `FactorizationKind` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class FactorizationKind; }
+
+#include "FactorizationKind.hpp"
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `Factorization`
+   * Inherit this class to create instances of `HybridFactorizationSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridFactorization: public HybridFactorizationSpec {
+   * public:
+   *   HybridFactorization(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridFactorizationSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridFactorizationSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridFactorizationSpec() override = default;
+
+    public:
+      // Properties
+      virtual FactorizationKind getKind() = 0;
+      virtual double getRows() = 0;
+      virtual double getCols() = 0;
+
+    public:
+      // Methods
+      virtual std::vector<double> solve(const std::vector<double>& b) = 0;
+      virtual std::vector<std::vector<double>> solveMany(const std::vector<std::vector<double>>& B) = 0;
+      virtual std::shared_ptr<ArrayBuffer> solveBuffer(const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual double determinant() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "Factorization";
+  };
+
+} // namespace margelo::nitro::rnmath
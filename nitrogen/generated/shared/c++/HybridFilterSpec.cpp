@@ -0,0 +1,23 @@
+///
+/// HybridFilterSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridFilterSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridFilterSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("process", &HybridFilterSpec::process);
+      prototype.registerHybridMethod("processBuffer", &HybridFilterSpec::processBuffer);
+      prototype.registerHybridMethod("reset", &HybridFilterSpec::reset);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
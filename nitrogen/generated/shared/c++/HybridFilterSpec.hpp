@@ -0,0 +1,66 @@
+///
+/// HybridFilterSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `Filter`
+   * Inherit this class to create instances of `HybridFilterSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridFilter: public HybridFilterSpec {
+   * public:
+   *   HybridFilter(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridFilterSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridFilterSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridFilterSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::vector<double> process(const std::vector<double>& chunk) = 0;
+      virtual std::shared_ptr<ArrayBuffer> processBuffer(const std::shared_ptr<ArrayBuffer>& chunk, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual void reset() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "Filter";
+  };
+
+} // namespace margelo::nitro::rnmath
@@ -59,6 +59,9 @@ namespace margelo::nitro::rnmath {
       prototype.registerHybridMethod("vectorStandardDeviation", &HybridMathSpec::vectorStandardDeviation);
       prototype.registerHybridMethod("vectorMin", &HybridMathSpec::vectorMin);
       prototype.registerHybridMethod("vectorMax", &HybridMathSpec::vectorMax);
+      prototype.registerHybridMethod("vectorMap", &HybridMathSpec::vectorMap);
+      prototype.registerHybridMethod("vectorPow", &HybridMathSpec::vectorPow);
+      prototype.registerHybridMethod("compileExpression", &HybridMathSpec::compileExpression);
       prototype.registerHybridMethod("matrixCreate", &HybridMathSpec::matrixCreate);
       prototype.registerHybridMethod("matrixIdentity", &HybridMathSpec::matrixIdentity);
       prototype.registerHybridMethod("matrixZeros", &HybridMathSpec::matrixZeros);
@@ -71,23 +74,84 @@ namespace margelo::nitro::rnmath {
       prototype.registerHybridMethod("matrixDeterminant", &HybridMathSpec::matrixDeterminant);
       prototype.registerHybridMethod("matrixInverse", &HybridMathSpec::matrixInverse);
       prototype.registerHybridMethod("matrixTrace", &HybridMathSpec::matrixTrace);
+      prototype.registerHybridMethod("matrixSolve", &HybridMathSpec::matrixSolve);
+      prototype.registerHybridMethod("factorize", &HybridMathSpec::factorize);
+      prototype.registerHybridMethod("createNativeArray", &HybridMathSpec::createNativeArray);
+      prototype.registerHybridMethod("nativeArrayFromVector", &HybridMathSpec::nativeArrayFromVector);
+      prototype.registerHybridMethod("nativeArrayFromMatrix", &HybridMathSpec::nativeArrayFromMatrix);
+      prototype.registerHybridMethod("nativeArrayZeros", &HybridMathSpec::nativeArrayZeros);
       prototype.registerHybridMethod("mean", &HybridMathSpec::mean);
       prototype.registerHybridMethod("median", &HybridMathSpec::median);
+      prototype.registerHybridMethod("quantiles", &HybridMathSpec::quantiles);
       prototype.registerHybridMethod("variance", &HybridMathSpec::variance);
       prototype.registerHybridMethod("standardDeviation", &HybridMathSpec::standardDeviation);
       prototype.registerHybridMethod("covariance", &HybridMathSpec::covariance);
       prototype.registerHybridMethod("correlation", &HybridMathSpec::correlation);
+      prototype.registerHybridMethod("describe", &HybridMathSpec::describe);
       prototype.registerHybridMethod("normalPDF", &HybridMathSpec::normalPDF);
       prototype.registerHybridMethod("normalCDF", &HybridMathSpec::normalCDF);
+      prototype.registerHybridMethod("createDistribution", &HybridMathSpec::createDistribution);
       prototype.registerHybridMethod("randomUniform", &HybridMathSpec::randomUniform);
       prototype.registerHybridMethod("randomNormal", &HybridMathSpec::randomNormal);
+      prototype.registerHybridMethod("createRandomGenerator", &HybridMathSpec::createRandomGenerator);
       prototype.registerHybridMethod("fft", &HybridMathSpec::fft);
+      prototype.registerHybridMethod("ifft", &HybridMathSpec::ifft);
+      prototype.registerHybridMethod("rfft", &HybridMathSpec::rfft);
+      prototype.registerHybridMethod("irfft", &HybridMathSpec::irfft);
+      prototype.registerHybridMethod("createFFTPlan", &HybridMathSpec::createFFTPlan);
       prototype.registerHybridMethod("convolve", &HybridMathSpec::convolve);
+      prototype.registerHybridMethod("createFIRFilter", &HybridMathSpec::createFIRFilter);
+      prototype.registerHybridMethod("createBiquadFilter", &HybridMathSpec::createBiquadFilter);
       prototype.registerHybridMethod("linearRegression", &HybridMathSpec::linearRegression);
+      prototype.registerHybridMethod("linearRegressionPredict", &HybridMathSpec::linearRegressionPredict);
+      prototype.registerHybridMethod("createOnlineRegression", &HybridMathSpec::createOnlineRegression);
+      prototype.registerHybridMethod("createNeuralNetwork", &HybridMathSpec::createNeuralNetwork);
       prototype.registerHybridMethod("factorial", &HybridMathSpec::factorial);
       prototype.registerHybridMethod("combinations", &HybridMathSpec::combinations);
       prototype.registerHybridMethod("gcd", &HybridMathSpec::gcd);
       prototype.registerHybridMethod("lcm", &HybridMathSpec::lcm);
+      prototype.registerHybridMethod("vectorDotProductBuffer", &HybridMathSpec::vectorDotProductBuffer);
+      prototype.registerHybridMethod("vectorNormBuffer", &HybridMathSpec::vectorNormBuffer);
+      prototype.registerHybridMethod("vectorSumBuffer", &HybridMathSpec::vectorSumBuffer);
+      prototype.registerHybridMethod("vectorAddBuffer", &HybridMathSpec::vectorAddBuffer);
+      prototype.registerHybridMethod("vectorSubtractBuffer", &HybridMathSpec::vectorSubtractBuffer);
+      prototype.registerHybridMethod("vectorScaleBuffer", &HybridMathSpec::vectorScaleBuffer);
+      prototype.registerHybridMethod("vectorMapBuffer", &HybridMathSpec::vectorMapBuffer);
+      prototype.registerHybridMethod("vectorPowBuffer", &HybridMathSpec::vectorPowBuffer);
+      prototype.registerHybridMethod("matrixMultiplyBuffer", &HybridMathSpec::matrixMultiplyBuffer);
+      prototype.registerHybridMethod("matrixTransposeBuffer", &HybridMathSpec::matrixTransposeBuffer);
+      prototype.registerHybridMethod("fftBuffer", &HybridMathSpec::fftBuffer);
+      prototype.registerHybridMethod("convolveBuffer", &HybridMathSpec::convolveBuffer);
+      prototype.registerHybridMethod("rfftBuffer", &HybridMathSpec::rfftBuffer);
+      prototype.registerHybridMethod("irfftBuffer", &HybridMathSpec::irfftBuffer);
+      prototype.registerHybridMethod("linearRegressionBuffer", &HybridMathSpec::linearRegressionBuffer);
+      prototype.registerHybridMethod("linearRegressionPredictBuffer", &HybridMathSpec::linearRegressionPredictBuffer);
+      prototype.registerHybridMethod("kmeansBuffer", &HybridMathSpec::kmeansBuffer);
+      prototype.registerHybridMethod("describeBuffer", &HybridMathSpec::describeBuffer);
+      prototype.registerHybridMethod("quantilesBuffer", &HybridMathSpec::quantilesBuffer);
+      prototype.registerHybridMethod("vectorDotProductBufferF32", &HybridMathSpec::vectorDotProductBufferF32);
+      prototype.registerHybridMethod("vectorNormBufferF32", &HybridMathSpec::vectorNormBufferF32);
+      prototype.registerHybridMethod("vectorSumBufferF32", &HybridMathSpec::vectorSumBufferF32);
+      prototype.registerHybridMethod("vectorAddBufferF32", &HybridMathSpec::vectorAddBufferF32);
+      prototype.registerHybridMethod("vectorSubtractBufferF32", &HybridMathSpec::vectorSubtractBufferF32);
+      prototype.registerHybridMethod("vectorScaleBufferF32", &HybridMathSpec::vectorScaleBufferF32);
+      prototype.registerHybridMethod("matrixMultiplyBufferF32", &HybridMathSpec::matrixMultiplyBufferF32);
+      prototype.registerHybridMethod("fftBufferF32", &HybridMathSpec::fftBufferF32);
+      prototype.registerHybridMethod("convolveBufferF32", &HybridMathSpec::convolveBufferF32);
+      prototype.registerHybridMethod("rfftBufferF32", &HybridMathSpec::rfftBufferF32);
+      prototype.registerHybridMethod("irfftBufferF32", &HybridMathSpec::irfftBufferF32);
+      prototype.registerHybridMethod("matrixMultiplyAsync", &HybridMathSpec::matrixMultiplyAsync);
+      prototype.registerHybridMethod("matrixInverseAsync", &HybridMathSpec::matrixInverseAsync);
+      prototype.registerHybridMethod("matrixSolveAsync", &HybridMathSpec::matrixSolveAsync);
+      prototype.registerHybridMethod("fftAsync", &HybridMathSpec::fftAsync);
+      prototype.registerHybridMethod("ifftAsync", &HybridMathSpec::ifftAsync);
+      prototype.registerHybridMethod("rfftAsync", &HybridMathSpec::rfftAsync);
+      prototype.registerHybridMethod("convolveAsync", &HybridMathSpec::convolveAsync);
+      prototype.registerHybridMethod("linearRegressionAsync", &HybridMathSpec::linearRegressionAsync);
+      prototype.registerHybridMethod("matrixMultiplyBufferAsync", &HybridMathSpec::matrixMultiplyBufferAsync);
+      prototype.registerHybridMethod("convolveBufferAsync", &HybridMathSpec::convolveBufferAsync);
+      prototype.registerHybridMethod("kmeansBufferAsync", &HybridMathSpec::kmeansBufferAsync);
+      prototype.registerHybridMethod("cancelPendingTasks", &HybridMathSpec::cancelPendingTasks);
     });
   }
 
@@ -13,11 +13,70 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
-
+// Forward declaration of `HybridFFTPlanSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridFFTPlanSpec; }
+// Forward declaration of `HybridFilterSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridFilterSpec; }
+// Forward declaration of `ConvolutionMode` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ConvolutionMode; }
+// Forward declaration of `HybridFactorizationSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridFactorizationSpec; }
+// Forward declaration of `FactorizationKind` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class FactorizationKind; }
+// Forward declaration of `RegressionMethod` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class RegressionMethod; }
+// Forward declaration of `HybridOnlineRegressionSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridOnlineRegressionSpec; }
+// Forward declaration of `KMeansResult` to properly resolve imports.
+namespace margelo::nitro::rnmath { struct KMeansResult; }
+// Forward declaration of `HybridNeuralNetworkSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridNeuralNetworkSpec; }
+// Forward declaration of `DenseLayer` to properly resolve imports.
+namespace margelo::nitro::rnmath { struct DenseLayer; }
+// Forward declaration of `ElementwiseFunction` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ElementwiseFunction; }
+// Forward declaration of `HybridExpressionSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridExpressionSpec; }
+// Forward declaration of `ExpressionNode` to properly resolve imports.
+namespace margelo::nitro::rnmath { struct ExpressionNode; }
+// Forward declaration of `HybridNativeArraySpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridNativeArraySpec; }
+// Forward declaration of `DType` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class DType; }
+// Forward declaration of `HybridRandomGeneratorSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridRandomGeneratorSpec; }
+// Forward declaration of `HybridDistributionSpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridDistributionSpec; }
+// Forward declaration of `DistributionKind` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class DistributionKind; }
+// Forward declaration of `SummaryStatistics` to properly resolve imports.
+namespace margelo::nitro::rnmath { struct SummaryStatistics; }
 
 #include <tuple>
 #include <vector>
 #include <optional>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include <NitroModules/Promise.hpp>
+#include "HybridFFTPlanSpec.hpp"
+#include "ConvolutionMode.hpp"
+#include "HybridFilterSpec.hpp"
+#include "HybridFactorizationSpec.hpp"
+#include "FactorizationKind.hpp"
+#include "RegressionMethod.hpp"
+#include "HybridOnlineRegressionSpec.hpp"
+#include "KMeansResult.hpp"
+#include "HybridNeuralNetworkSpec.hpp"
+#include "DenseLayer.hpp"
+#include "ElementwiseFunction.hpp"
+#include "HybridExpressionSpec.hpp"
+#include "ExpressionNode.hpp"
+#include "HybridNativeArraySpec.hpp"
+#include "DType.hpp"
+#include "HybridRandomGeneratorSpec.hpp"
+#include "HybridDistributionSpec.hpp"
+#include "DistributionKind.hpp"
+#include "SummaryStatistics.hpp"
 
 namespace margelo::nitro::rnmath {
 
@@ -95,6 +154,9 @@ namespace margelo::nitro::rnmath {
       virtual double vectorStandardDeviation(const std::vector<double>& vector, std::optional<bool> population) = 0;
       virtual double vectorMin(const std::vector<double>& vector) = 0;
       virtual double vectorMax(const std::vector<double>& vector) = 0;
+      virtual std::vector<double> vectorMap(ElementwiseFunction fn, const std::vector<double>& vector) = 0;
+      virtual std::vector<double> vectorPow(const std::vector<double>& vector, double exponent) = 0;
+      virtual std::shared_ptr<HybridExpressionSpec> compileExpression(const std::vector<ExpressionNode>& nodes) = 0;
       virtual std::vector<std::vector<double>> matrixCreate(const std::vector<std::vector<double>>& elements) = 0;
       virtual std::vector<std::vector<double>> matrixIdentity(double size) = 0;
       virtual std::vector<std::vector<double>> matrixZeros(double rows, double cols) = 0;
@@ -107,23 +169,84 @@ namespace margelo::nitro::rnmath {
       virtual double matrixDeterminant(const std::vector<std::vector<double>>& matrix) = 0;
       virtual std::vector<std::vector<double>> matrixInverse(const std::vector<std::vector<double>>& matrix) = 0;
       virtual double matrixTrace(const std::vector<std::vector<double>>& matrix) = 0;
+      virtual std::vector<double> matrixSolve(const std::vector<std::vector<double>>& A, const std::vector<double>& b) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridFactorizationSpec> factorize(const std::vector<std::vector<double>>& matrix, std::optional<FactorizationKind> kind) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> createNativeArray(const std::shared_ptr<ArrayBuffer>& data, double rows, double cols, std::optional<DType> dtype) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> nativeArrayFromVector(const std::vector<double>& vector, std::optional<DType> dtype) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> nativeArrayFromMatrix(const std::vector<std::vector<double>>& matrix, std::optional<DType> dtype) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> nativeArrayZeros(double rows, double cols, std::optional<DType> dtype) = 0;
       virtual double mean(const std::vector<double>& data) = 0;
       virtual double median(const std::vector<double>& data) = 0;
+      virtual std::vector<double> quantiles(const std::vector<double>& data, const std::vector<double>& probabilities) = 0;
       virtual double variance(const std::vector<double>& data, std::optional<bool> population) = 0;
       virtual double standardDeviation(const std::vector<double>& data, std::optional<bool> population) = 0;
       virtual double covariance(const std::vector<double>& a, const std::vector<double>& b) = 0;
       virtual double correlation(const std::vector<double>& a, const std::vector<double>& b) = 0;
+      virtual SummaryStatistics describe(const std::vector<double>& data, std::optional<bool> population) = 0;
       virtual double normalPDF(double x, std::optional<double> mean, std::optional<double> stddev) = 0;
       virtual double normalCDF(double x, std::optional<double> mean, std::optional<double> stddev) = 0;
+      virtual std::shared_ptr<HybridDistributionSpec> createDistribution(DistributionKind kind, const std::optional<std::vector<double>>& params) = 0;
       virtual std::vector<double> randomUniform(double count, std::optional<double> min, std::optional<double> max) = 0;
       virtual std::vector<double> randomNormal(double count, std::optional<double> mean, std::optional<double> stddev) = 0;
+      virtual std::shared_ptr<HybridRandomGeneratorSpec> createRandomGenerator(std::optional<double> seed) = 0;
       virtual std::tuple<std::vector<double>, std::vector<double>> fft(const std::vector<double>& real, const std::vector<double>& imag) = 0;
-      virtual std::vector<double> convolve(const std::vector<double>& signal, const std::vector<double>& kernel) = 0;
-      virtual std::vector<double> linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y) = 0;
+      virtual std::tuple<std::vector<double>, std::vector<double>> ifft(const std::vector<double>& real, const std::vector<double>& imag) = 0;
+      virtual std::tuple<std::vector<double>, std::vector<double>> rfft(const std::vector<double>& signal) = 0;
+      virtual std::vector<double> irfft(const std::vector<double>& real, const std::vector<double>& imag, std::optional<double> size) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridFFTPlanSpec> createFFTPlan(double size, std::optional<bool> inverse) = 0;
+      virtual std::vector<double> convolve(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridFilterSpec> createFIRFilter(const std::vector<double>& taps) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridFilterSpec> createBiquadFilter(const std::vector<std::vector<double>>& sections) = 0;
+      virtual std::vector<double> linearRegression(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) = 0;
+      virtual std::vector<double> linearRegressionPredict(const std::vector<std::vector<double>>& X, const std::vector<double>& coefficients) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridOnlineRegressionSpec> createOnlineRegression(double features, std::optional<double> forgetting, std::optional<double> ridge) = 0;
+      virtual std::shared_ptr<margelo::nitro::rnmath::HybridNeuralNetworkSpec> createNeuralNetwork(const std::vector<DenseLayer>& layers) = 0;
       virtual double factorial(double n) = 0;
       virtual double combinations(double n, double k) = 0;
       virtual double gcd(double a, double b) = 0;
       virtual double lcm(double a, double b) = 0;
+      virtual double vectorDotProductBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) = 0;
+      virtual double vectorNormBuffer(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) = 0;
+      virtual double vectorSumBuffer(const std::shared_ptr<ArrayBuffer>& vector) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorAddBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorSubtractBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorScaleBuffer(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorMapBuffer(ElementwiseFunction fn, const std::shared_ptr<ArrayBuffer>& vector, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorPowBuffer(const std::shared_ptr<ArrayBuffer>& vector, double exponent, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> matrixMultiplyBuffer(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> matrixTransposeBuffer(const std::shared_ptr<ArrayBuffer>& matrix, double rows, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> fftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) = 0;
+      virtual std::shared_ptr<ArrayBuffer> convolveBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) = 0;
+      virtual std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> rfftBuffer(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) = 0;
+      virtual std::shared_ptr<ArrayBuffer> irfftBuffer(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::vector<double> linearRegressionBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y, double features, std::optional<double> ridge, std::optional<RegressionMethod> method) = 0;
+      virtual std::shared_ptr<ArrayBuffer> linearRegressionPredictBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::vector<double>& coefficients, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual KMeansResult kmeansBuffer(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) = 0;
+      virtual SummaryStatistics describeBuffer(const std::shared_ptr<ArrayBuffer>& data, std::optional<bool> population) = 0;
+      virtual std::vector<double> quantilesBuffer(const std::shared_ptr<ArrayBuffer>& data, const std::vector<double>& probabilities, std::optional<bool> inPlace) = 0;
+      virtual double vectorDotProductBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b) = 0;
+      virtual double vectorNormBufferF32(const std::shared_ptr<ArrayBuffer>& vector, std::optional<double> p) = 0;
+      virtual double vectorSumBufferF32(const std::shared_ptr<ArrayBuffer>& vector) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorAddBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorSubtractBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> vectorScaleBufferF32(const std::shared_ptr<ArrayBuffer>& vector, double scalar, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> matrixMultiplyBufferF32(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> fftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) = 0;
+      virtual std::shared_ptr<ArrayBuffer> convolveBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, const std::optional<std::shared_ptr<ArrayBuffer>>& out, std::optional<ConvolutionMode> mode) = 0;
+      virtual std::tuple<std::shared_ptr<ArrayBuffer>, std::shared_ptr<ArrayBuffer>> rfftBufferF32(const std::shared_ptr<ArrayBuffer>& signal, const std::optional<std::shared_ptr<ArrayBuffer>>& outReal, const std::optional<std::shared_ptr<ArrayBuffer>>& outImag) = 0;
+      virtual std::shared_ptr<ArrayBuffer> irfftBufferF32(const std::shared_ptr<ArrayBuffer>& real, const std::shared_ptr<ArrayBuffer>& imag, std::optional<double> size, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<Promise<std::vector<std::vector<double>>>> matrixMultiplyAsync(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) = 0;
+      virtual std::shared_ptr<Promise<std::vector<std::vector<double>>>> matrixInverseAsync(const std::vector<std::vector<double>>& matrix) = 0;
+      virtual std::shared_ptr<Promise<std::vector<double>>> matrixSolveAsync(const std::vector<std::vector<double>>& A, const std::vector<double>& b) = 0;
+      virtual std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> fftAsync(const std::vector<double>& real, const std::vector<double>& imag) = 0;
+      virtual std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> ifftAsync(const std::vector<double>& real, const std::vector<double>& imag) = 0;
+      virtual std::shared_ptr<Promise<std::tuple<std::vector<double>, std::vector<double>>>> rfftAsync(const std::vector<double>& signal) = 0;
+      virtual std::shared_ptr<Promise<std::vector<double>>> convolveAsync(const std::vector<double>& signal, const std::vector<double>& kernel, std::optional<ConvolutionMode> mode) = 0;
+      virtual std::shared_ptr<Promise<std::vector<double>>> linearRegressionAsync(const std::vector<std::vector<double>>& X, const std::vector<double>& y, std::optional<double> ridge, std::optional<RegressionMethod> method) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> matrixMultiplyBufferAsync(const std::shared_ptr<ArrayBuffer>& a, const std::shared_ptr<ArrayBuffer>& b, double rows, double inner, double cols) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> convolveBufferAsync(const std::shared_ptr<ArrayBuffer>& signal, const std::shared_ptr<ArrayBuffer>& kernel, std::optional<ConvolutionMode> mode) = 0;
+      virtual std::shared_ptr<Promise<KMeansResult>> kmeansBufferAsync(const std::shared_ptr<ArrayBuffer>& points, double dimensions, double k, std::optional<double> maxIterations, std::optional<double> seed) = 0;
+      virtual double cancelPendingTasks() = 0;
 
     protected:
       // Hybrid Setup
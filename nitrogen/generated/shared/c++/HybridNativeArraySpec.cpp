@@ -0,0 +1,51 @@
+///
+/// HybridNativeArraySpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridNativeArraySpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridNativeArraySpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("rows", &HybridNativeArraySpec::getRows);
+      prototype.registerHybridGetter("cols", &HybridNativeArraySpec::getCols);
+      prototype.registerHybridGetter("size", &HybridNativeArraySpec::getSize);
+      prototype.registerHybridGetter("dtype", &HybridNativeArraySpec::getDtype);
+      prototype.registerHybridGetter("buffer", &HybridNativeArraySpec::getBuffer);
+      prototype.registerHybridMethod("toArray", &HybridNativeArraySpec::toArray);
+      prototype.registerHybridMethod("toMatrix", &HybridNativeArraySpec::toMatrix);
+      prototype.registerHybridMethod("clone", &HybridNativeArraySpec::clone);
+      prototype.registerHybridMethod("astype", &HybridNativeArraySpec::astype);
+      prototype.registerHybridMethod("reshape", &HybridNativeArraySpec::reshape);
+      prototype.registerHybridMethod("transpose", &HybridNativeArraySpec::transpose);
+      prototype.registerHybridMethod("add", &HybridNativeArraySpec::add);
+      prototype.registerHybridMethod("sub", &HybridNativeArraySpec::sub);
+      prototype.registerHybridMethod("mul", &HybridNativeArraySpec::mul);
+      prototype.registerHybridMethod("div", &HybridNativeArraySpec::div);
+      prototype.registerHybridMethod("scale", &HybridNativeArraySpec::scale);
+      prototype.registerHybridMethod("map", &HybridNativeArraySpec::map);
+      prototype.registerHybridMethod("pow", &HybridNativeArraySpec::pow);
+      prototype.registerHybridMethod("matmul", &HybridNativeArraySpec::matmul);
+      prototype.registerHybridMethod("solve", &HybridNativeArraySpec::solve);
+      prototype.registerHybridMethod("inverse", &HybridNativeArraySpec::inverse);
+      prototype.registerHybridMethod("dot", &HybridNativeArraySpec::dot);
+      prototype.registerHybridMethod("norm", &HybridNativeArraySpec::norm);
+      prototype.registerHybridMethod("sum", &HybridNativeArraySpec::sum);
+      prototype.registerHybridMethod("mean", &HybridNativeArraySpec::mean);
+      prototype.registerHybridMethod("min", &HybridNativeArraySpec::min);
+      prototype.registerHybridMethod("max", &HybridNativeArraySpec::max);
+      prototype.registerHybridMethod("variance", &HybridNativeArraySpec::variance);
+      prototype.registerHybridMethod("rfft", &HybridNativeArraySpec::rfft);
+      prototype.registerHybridMethod("irfft", &HybridNativeArraySpec::irfft);
+      prototype.registerHybridMethod("convolve", &HybridNativeArraySpec::convolve);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,104 @@
+///
+/// HybridNativeArraySpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `DType` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class DType; }
+// Forward declaration of `HybridNativeArraySpec` to properly resolve imports.
+namespace margelo::nitro::rnmath { class HybridNativeArraySpec; }
+// Forward declaration of `ElementwiseFunction` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ElementwiseFunction; }
+// Forward declaration of `ConvolutionMode` to properly resolve imports.
+namespace margelo::nitro::rnmath { enum class ConvolutionMode; }
+
+#include "DType.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include <vector>
+#include <memory>
+#include "ElementwiseFunction.hpp"
+#include <optional>
+#include "ConvolutionMode.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `NativeArray`
+   * Inherit this class to create instances of `HybridNativeArraySpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridNativeArray: public HybridNativeArraySpec {
+   * public:
+   *   HybridNativeArray(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridNativeArraySpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridNativeArraySpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridNativeArraySpec() override = default;
+
+    public:
+      // Properties
+      virtual double getRows() = 0;
+      virtual double getCols() = 0;
+      virtual double getSize() = 0;
+      virtual DType getDtype() = 0;
+      virtual std::shared_ptr<ArrayBuffer> getBuffer() = 0;
+
+    public:
+      // Methods
+      virtual std::vector<double> toArray() = 0;
+      virtual std::vector<std::vector<double>> toMatrix() = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> clone() = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> astype(DType dtype) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> reshape(double rows, double cols) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> transpose() = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> add(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> sub(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> mul(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> div(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> scale(double scalar) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> map(ElementwiseFunction fn) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> pow(double exponent) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> matmul(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> solve(const std::shared_ptr<HybridNativeArraySpec>& b) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> inverse() = 0;
+      virtual double dot(const std::shared_ptr<HybridNativeArraySpec>& other) = 0;
+      virtual double norm() = 0;
+      virtual double sum() = 0;
+      virtual double mean() = 0;
+      virtual double min() = 0;
+      virtual double max() = 0;
+      virtual double variance(std::optional<bool> population) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> rfft() = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> irfft(std::optional<double> size) = 0;
+      virtual std::shared_ptr<HybridNativeArraySpec> convolve(const std::shared_ptr<HybridNativeArraySpec>& kernel, std::optional<ConvolutionMode> mode) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "NativeArray";
+  };
+
+} // namespace margelo::nitro::rnmath
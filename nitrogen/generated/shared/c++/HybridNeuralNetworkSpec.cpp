@@ -0,0 +1,25 @@
+///
+/// HybridNeuralNetworkSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridNeuralNetworkSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridNeuralNetworkSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("inputSize", &HybridNeuralNetworkSpec::getInputSize);
+      prototype.registerHybridGetter("outputSize", &HybridNeuralNetworkSpec::getOutputSize);
+      prototype.registerHybridGetter("layers", &HybridNeuralNetworkSpec::getLayers);
+      prototype.registerHybridMethod("forward", &HybridNeuralNetworkSpec::forward);
+      prototype.registerHybridMethod("forwardBuffer", &HybridNeuralNetworkSpec::forwardBuffer);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
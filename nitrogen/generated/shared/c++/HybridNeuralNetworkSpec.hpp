@@ -0,0 +1,67 @@
+///
+/// HybridNeuralNetworkSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `NeuralNetwork`
+   * Inherit this class to create instances of `HybridNeuralNetworkSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridNeuralNetwork: public HybridNeuralNetworkSpec {
+   * public:
+   *   HybridNeuralNetwork(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridNeuralNetworkSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridNeuralNetworkSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridNeuralNetworkSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getInputSize() = 0;
+      virtual double getOutputSize() = 0;
+      virtual double getLayers() = 0;
+
+    public:
+      // Methods
+      virtual std::vector<std::vector<double>> forward(const std::vector<std::vector<double>>& batch) = 0;
+      virtual std::shared_ptr<ArrayBuffer> forwardBuffer(const std::shared_ptr<ArrayBuffer>& batch, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "NeuralNetwork";
+  };
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,28 @@
+///
+/// HybridOnlineRegressionSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridOnlineRegressionSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridOnlineRegressionSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("features", &HybridOnlineRegressionSpec::getFeatures);
+      prototype.registerHybridGetter("forgetting", &HybridOnlineRegressionSpec::getForgetting);
+      prototype.registerHybridGetter("weight", &HybridOnlineRegressionSpec::getWeight);
+      prototype.registerHybridMethod("update", &HybridOnlineRegressionSpec::update);
+      prototype.registerHybridMethod("updateBuffer", &HybridOnlineRegressionSpec::updateBuffer);
+      prototype.registerHybridMethod("coefficients", &HybridOnlineRegressionSpec::coefficients);
+      prototype.registerHybridMethod("predict", &HybridOnlineRegressionSpec::predict);
+      prototype.registerHybridMethod("reset", &HybridOnlineRegressionSpec::reset);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
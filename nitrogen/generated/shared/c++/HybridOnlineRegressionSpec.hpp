@@ -0,0 +1,69 @@
+///
+/// HybridOnlineRegressionSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `OnlineRegression`
+   * Inherit this class to create instances of `HybridOnlineRegressionSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridOnlineRegression: public HybridOnlineRegressionSpec {
+   * public:
+   *   HybridOnlineRegression(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridOnlineRegressionSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridOnlineRegressionSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridOnlineRegressionSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getFeatures() = 0;
+      virtual double getForgetting() = 0;
+      virtual double getWeight() = 0;
+
+    public:
+      // Methods
+      virtual void update(const std::vector<std::vector<double>>& X, const std::vector<double>& y) = 0;
+      virtual void updateBuffer(const std::shared_ptr<ArrayBuffer>& X, const std::shared_ptr<ArrayBuffer>& y) = 0;
+      virtual std::vector<double> coefficients() = 0;
+      virtual std::vector<double> predict(const std::vector<std::vector<double>>& X) = 0;
+      virtual void reset() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "OnlineRegression";
+  };
+
+} // namespace margelo::nitro::rnmath
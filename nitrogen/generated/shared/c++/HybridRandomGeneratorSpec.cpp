@@ -0,0 +1,25 @@
+///
+/// HybridRandomGeneratorSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridRandomGeneratorSpec.hpp"
+
+namespace margelo::nitro::rnmath {
+
+  void HybridRandomGeneratorSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("reseed", &HybridRandomGeneratorSpec::reseed);
+      prototype.registerHybridMethod("uniform", &HybridRandomGeneratorSpec::uniform);
+      prototype.registerHybridMethod("normal", &HybridRandomGeneratorSpec::normal);
+      prototype.registerHybridMethod("uniformBuffer", &HybridRandomGeneratorSpec::uniformBuffer);
+      prototype.registerHybridMethod("normalBuffer", &HybridRandomGeneratorSpec::normalBuffer);
+    });
+  }
+
+} // namespace margelo::nitro::rnmath
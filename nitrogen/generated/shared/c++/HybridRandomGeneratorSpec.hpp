@@ -0,0 +1,68 @@
+///
+/// HybridRandomGeneratorSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+#include <optional>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::rnmath {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `RandomGenerator`
+   * Inherit this class to create instances of `HybridRandomGeneratorSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridRandomGenerator: public HybridRandomGeneratorSpec {
+   * public:
+   *   HybridRandomGenerator(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridRandomGeneratorSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridRandomGeneratorSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridRandomGeneratorSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual void reseed(double seed) = 0;
+      virtual std::vector<double> uniform(double count, std::optional<double> min, std::optional<double> max) = 0;
+      virtual std::vector<double> normal(double count, std::optional<double> mean, std::optional<double> stddev) = 0;
+      virtual std::shared_ptr<ArrayBuffer> uniformBuffer(double count, std::optional<double> min, std::optional<double> max, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+      virtual std::shared_ptr<ArrayBuffer> normalBuffer(double count, std::optional<double> mean, std::optional<double> stddev, const std::optional<std::shared_ptr<ArrayBuffer>>& out) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "RandomGenerator";
+  };
+
+} // namespace margelo::nitro::rnmath
@@ -0,0 +1,85 @@
+///
+/// KMeansResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * A struct which can be represented as a JavaScript object (KMeansResult).
+   */
+  struct KMeansResult {
+  public:
+    std::shared_ptr<ArrayBuffer> centroids     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> labels     SWIFT_PRIVATE;
+    double inertia     SWIFT_PRIVATE;
+    double iterations     SWIFT_PRIVATE;
+    bool converged     SWIFT_PRIVATE;
+
+  public:
+    KMeansResult() = default;
+    explicit KMeansResult(std::shared_ptr<ArrayBuffer> centroids, std::shared_ptr<ArrayBuffer> labels, double inertia, double iterations, bool converged): centroids(centroids), labels(labels), inertia(inertia), iterations(iterations), converged(converged) {}
+  };
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ KMeansResult <> JS KMeansResult (object)
+  template <>
+  struct JSIConverter<KMeansResult> final {
+    static inline KMeansResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return KMeansResult(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "centroids")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "labels")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "inertia")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "iterations")),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, "converged"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const KMeansResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "centroids", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.centroids));
+      obj.setProperty(runtime, "labels", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.labels));
+      obj.setProperty(runtime, "inertia", JSIConverter<double>::toJSI(runtime, arg.inertia));
+      obj.setProperty(runtime, "iterations", JSIConverter<double>::toJSI(runtime, arg.iterations));
+      obj.setProperty(runtime, "converged", JSIConverter<bool>::toJSI(runtime, arg.converged));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "centroids"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "labels"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "inertia"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "iterations"))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, "converged"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
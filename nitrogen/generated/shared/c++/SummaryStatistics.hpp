@@ -0,0 +1,91 @@
+///
+/// SummaryStatistics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::rnmath {
+
+  /**
+   * A struct which can be represented as a JavaScript object (SummaryStatistics).
+   */
+  struct SummaryStatistics {
+  public:
+    double count     SWIFT_PRIVATE;
+    double sum     SWIFT_PRIVATE;
+    double mean     SWIFT_PRIVATE;
+    double variance     SWIFT_PRIVATE;
+    double standardDeviation     SWIFT_PRIVATE;
+    double min     SWIFT_PRIVATE;
+    double max     SWIFT_PRIVATE;
+
+  public:
+    SummaryStatistics() = default;
+    explicit SummaryStatistics(double count, double sum, double mean, double variance, double standardDeviation, double min, double max): count(count), sum(sum), mean(mean), variance(variance), standardDeviation(standardDeviation), min(min), max(max) {}
+  };
+
+} // namespace margelo::nitro::rnmath
+
+namespace margelo::nitro {
+
+  using namespace margelo::nitro::rnmath;
+
+  // C++ SummaryStatistics <> JS SummaryStatistics (object)
+  template <>
+  struct JSIConverter<SummaryStatistics> final {
+    static inline SummaryStatistics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return SummaryStatistics(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "count")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "sum")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "mean")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "variance")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "standardDeviation")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "min")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "max"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const SummaryStatistics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "count", JSIConverter<double>::toJSI(runtime, arg.count));
+      obj.setProperty(runtime, "sum", JSIConverter<double>::toJSI(runtime, arg.sum));
+      obj.setProperty(runtime, "mean", JSIConverter<double>::toJSI(runtime, arg.mean));
+      obj.setProperty(runtime, "variance", JSIConverter<double>::toJSI(runtime, arg.variance));
+      obj.setProperty(runtime, "standardDeviation", JSIConverter<double>::toJSI(runtime, arg.standardDeviation));
+      obj.setProperty(runtime, "min", JSIConverter<double>::toJSI(runtime, arg.min));
+      obj.setProperty(runtime, "max", JSIConverter<double>::toJSI(runtime, arg.max));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "count"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "sum"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "mean"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "variance"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "standardDeviation"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "min"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "max"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
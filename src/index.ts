@@ -1,11 +1,215 @@
 // src/index.ts
 import { NitroModules } from 'react-native-nitro-modules'
-import type { Complex, Math, Matrix, Vector } from './specs/Math.nitro'
+import type {
+  Complex,
+  ConvolutionMode,
+  ElementwiseFunction,
+  KMeansResult,
+  Math,
+  Matrix,
+  RegressionMethod,
+  SummaryStatistics,
+  Vector,
+} from './specs/Math.nitro'
+import type { FFTPlan } from './specs/FFTPlan.nitro'
+import type { Filter } from './specs/Filter.nitro'
+import type { OnlineRegression } from './specs/OnlineRegression.nitro'
+import type {
+  Expression,
+  ExpressionNode,
+  ExpressionOp,
+  ExpressionReduction,
+} from './specs/Expression.nitro'
+import type {
+  Activation,
+  DenseLayer,
+  NeuralNetwork,
+} from './specs/NeuralNetwork.nitro'
+import type {
+  Factorization,
+  FactorizationKind,
+} from './specs/Factorization.nitro'
+import type { DType, NativeArray } from './specs/NativeArray.nitro'
+import type { RandomGenerator } from './specs/RandomGenerator.nitro'
+import type {
+  Distribution,
+  DistributionKind,
+} from './specs/Distribution.nitro'
 
-export type { Complex, Math, Matrix, Vector }
+export type {
+  Activation,
+  Complex,
+  ConvolutionMode,
+  DenseLayer,
+  Distribution,
+  DistributionKind,
+  DType,
+  ElementwiseFunction,
+  Expression,
+  ExpressionNode,
+  ExpressionOp,
+  ExpressionReduction,
+  Factorization,
+  FactorizationKind,
+  FFTPlan,
+  Filter,
+  KMeansResult,
+  Math,
+  Matrix,
+  NativeArray,
+  NeuralNetwork,
+  OnlineRegression,
+  RandomGenerator,
+  RegressionMethod,
+  SummaryStatistics,
+  Vector,
+}
 
 export const math: Math = NitroModules.createHybridObject<Math>('Math')
 
+// Float64 data accepted by the zero-copy `buffer` APIs
+export type Float64Input = Float64Array | ArrayBuffer
+// Float32 data accepted by the single-precision `buffer.f32` APIs
+export type Float32Input = Float32Array | ArrayBuffer
+
+// Returns the ArrayBuffer backing `data` without copying when the array spans
+// its whole buffer. Partial views (subarrays) are copied into a fresh buffer.
+const toBuffer = (data: Float64Input | Float32Input): ArrayBuffer => {
+  if (data instanceof ArrayBuffer) return data
+  if (data.byteOffset === 0 && data.byteLength === data.buffer.byteLength) {
+    return data.buffer as ArrayBuffer
+  }
+  return data.slice().buffer as ArrayBuffer
+}
+
+// Output buffers are written in place, so they can never be copied
+const toOutBuffer = (
+  out?: Float64Input | Float32Input
+): ArrayBuffer | undefined => {
+  if (out === undefined || out instanceof ArrayBuffer) return out
+  if (out.byteOffset !== 0 || out.byteLength !== out.buffer.byteLength) {
+    throw new Error('Output typed array must span its entire ArrayBuffer')
+  }
+  return out.buffer as ArrayBuffer
+}
+
+// Lazy element-wise expression over equally long Float64 inputs. Operations
+// only record a graph; it is compiled to native code on first use, and every
+// evaluation is then a single fused pass with no intermediate arrays.
+export class Expr {
+  private compiled?: Expression
+
+  private constructor(
+    private readonly op: ExpressionOp,
+    private readonly operands: Expr[] = [],
+    private readonly value?: number,
+    private readonly fn?: ElementwiseFunction
+  ) {}
+
+  // The `index`-th array passed to evaluate or reduce
+  static input(index: number): Expr {
+    return new Expr('input', [], index)
+  }
+
+  static constant(value: number): Expr {
+    return new Expr('constant', [], value)
+  }
+
+  add(other: Expr | number): Expr {
+    return this.binary('add', other)
+  }
+
+  sub(other: Expr | number): Expr {
+    return this.binary('sub', other)
+  }
+
+  mul(other: Expr | number): Expr {
+    return this.binary('mul', other)
+  }
+
+  div(other: Expr | number): Expr {
+    return this.binary('div', other)
+  }
+
+  min(other: Expr | number): Expr {
+    return this.binary('min', other)
+  }
+
+  max(other: Expr | number): Expr {
+    return this.binary('max', other)
+  }
+
+  neg(): Expr {
+    return new Expr('neg', [this])
+  }
+
+  map(fn: ElementwiseFunction): Expr {
+    return new Expr('map', [this], undefined, fn)
+  }
+
+  pow(exponent: number): Expr {
+    return new Expr('pow', [this], exponent)
+  }
+
+  // Operands come before their users; a subexpression used twice is
+  // emitted once
+  toNodes(): ExpressionNode[] {
+    const nodes: ExpressionNode[] = []
+    const indices = new Map<Expr, number>()
+    const visit = (e: Expr): number => {
+      const known = indices.get(e)
+      if (known !== undefined) return known
+      const [a, b] = e.operands.map(visit)
+      nodes.push({ op: e.op, a, b, value: e.value, fn: e.fn })
+      indices.set(e, nodes.length - 1)
+      return nodes.length - 1
+    }
+    visit(this)
+    return nodes
+  }
+
+  compile(): Expression {
+    if (this.compiled === undefined) {
+      this.compiled = math.compileExpression(this.toNodes())
+    }
+    return this.compiled
+  }
+
+  // `out` may be one of the inputs
+  evaluate(inputs: Float64Input[], out?: Float64Input): Float64Array {
+    return new Float64Array(
+      this.compile().evaluateBuffer(inputs.map(toBuffer), toOutBuffer(out))
+    )
+  }
+
+  reduce(inputs: Float64Input[], reduction: ExpressionReduction): number {
+    return this.compile().reduceBuffer(inputs.map(toBuffer), reduction)
+  }
+
+  private binary(op: ExpressionOp, other: Expr | number): Expr {
+    const rhs = typeof other === 'number' ? Expr.constant(other) : other
+    return new Expr(op, [this, rhs])
+  }
+}
+
+// k-means result with typed-array views over the native buffers
+export interface Clustering {
+  // k rows of `dimensions` values
+  centroids: Float64Array
+  labels: Int32Array
+  inertia: number
+  iterations: number
+  converged: boolean
+}
+
+const toClustering = (result: KMeansResult): Clustering => ({
+  centroids: new Float64Array(result.centroids),
+  labels: new Int32Array(result.labels),
+  inertia: result.inertia,
+  iterations: result.iterations,
+  converged: result.converged,
+})
+
 export const MathLibrary = {
   // Basic arithmetic
   add: (a: number, b: number): number => math.add(a, b),
@@ -53,6 +257,34 @@ export const MathLibrary = {
     abs: (a: Complex): number => math.complexAbsolute(a),
   },
 
+  // Fused element-wise expressions, see `Expr`
+  expr: {
+    input: (index: number): Expr => Expr.input(index),
+    constant: (value: number): Expr => Expr.constant(value),
+  },
+
+  // Arrays kept in native memory between calls, see `NativeArray`. Vectors
+  // become n x 1 columns; typed arrays are copied once on creation.
+  array: {
+    fromVector: (vector: Vector, dtype?: DType): NativeArray =>
+      math.nativeArrayFromVector(vector, dtype),
+    fromMatrix: (matrix: Matrix, dtype?: DType): NativeArray =>
+      math.nativeArrayFromMatrix(matrix, dtype),
+    fromBuffer: (
+      data: Float64Input | Float32Input,
+      rows: number,
+      cols: number
+    ): NativeArray =>
+      math.createNativeArray(
+        toBuffer(data),
+        rows,
+        cols,
+        data instanceof Float32Array ? 'float32' : 'float64'
+      ),
+    zeros: (rows: number, cols: number, dtype?: DType): NativeArray =>
+      math.nativeArrayZeros(rows, cols, dtype),
+  },
+
   // Re-export domain-specific modules
   algebra: {
     vector: {
@@ -72,6 +304,9 @@ export const MathLibrary = {
         math.vectorStandardDeviation(v, population),
       min: (v: Vector): number => math.vectorMin(v),
       max: (v: Vector): number => math.vectorMax(v),
+      map: (fn: ElementwiseFunction, v: Vector): Vector =>
+        math.vectorMap(fn, v),
+      pow: (v: Vector, exponent: number): Vector => math.vectorPow(v, exponent),
     },
     matrix: {
       create: (elements: number[][]): Matrix => math.matrixCreate(elements),
@@ -87,18 +322,29 @@ export const MathLibrary = {
       det: (m: Matrix): number => math.matrixDeterminant(m),
       inv: (m: Matrix): Matrix => math.matrixInverse(m),
       trace: (m: Matrix): number => math.matrixTrace(m),
+      solve: (A: Matrix, b: Vector): Vector => math.matrixSolve(A, b),
+      factorize: (m: Matrix, kind: FactorizationKind = 'lu'): Factorization =>
+        math.factorize(m, kind),
     },
   },
 
   statistics: {
     mean: (data: Vector): number => math.mean(data),
     median: (data: Vector): number => math.median(data),
+    // Several quantiles from one selection pass, e.g. [0.5, 0.9, 0.99]
+    quantiles: (data: Vector, probabilities: Vector): Vector =>
+      math.quantiles(data, probabilities),
+    percentiles: (data: Vector, percents: Vector): Vector =>
+      math.quantiles(data, percents.map((p) => p / 100)),
     variance: (data: Vector, population: boolean = false): number =>
       math.variance(data, population),
     std: (data: Vector, population: boolean = false): number =>
       math.standardDeviation(data, population),
     covariance: (a: Vector, b: Vector): number => math.covariance(a, b),
     correlation: (a: Vector, b: Vector): number => math.correlation(a, b),
+    // Count, sum, mean, variance, std, min and max from one pass
+    describe: (data: Vector, population: boolean = false): SummaryStatistics =>
+      math.describe(data, population),
   },
 
   probability: {
@@ -108,6 +354,9 @@ export const MathLibrary = {
       cdf: (x: number, mean?: number, stddev?: number): number =>
         math.normalCDF(x, mean, stddev),
     },
+    // Parameters are validated once; the object evaluates whole arrays
+    distribution: (kind: DistributionKind, params?: Vector): Distribution =>
+      math.createDistribution(kind, params),
   },
 
   random: {
@@ -115,17 +364,410 @@ export const MathLibrary = {
       math.randomUniform(count, min, max),
     normal: (count: number, mean: number = 0, stddev: number = 1): Vector =>
       math.randomNormal(count, mean, stddev),
+    // Seeded generator for reproducible streams; keep it for repeated draws
+    createGenerator: (seed?: number): RandomGenerator =>
+      math.createRandomGenerator(seed),
   },
 
   signal: {
     fft: (real: Vector, imag: Vector): [Vector, Vector] => math.fft(real, imag),
-    convolve: (signal: Vector, kernel: Vector): Vector =>
-      math.convolve(signal, kernel),
+    ifft: (real: Vector, imag: Vector): [Vector, Vector] =>
+      math.ifft(real, imag),
+    rfft: (signal: Vector): [Vector, Vector] => math.rfft(signal),
+    irfft: (real: Vector, imag: Vector, size?: number): Vector =>
+      math.irfft(real, imag, size),
+    createFFTPlan: (size: number, inverse: boolean = false): FFTPlan =>
+      math.createFFTPlan(size, inverse),
+    convolve: (
+      signal: Vector,
+      kernel: Vector,
+      mode: ConvolutionMode = 'auto'
+    ): Vector => math.convolve(signal, kernel, mode),
+    createFIRFilter: (taps: Vector): Filter => math.createFIRFilter(taps),
+    createBiquadFilter: (sections: Matrix): Filter =>
+      math.createBiquadFilter(sections),
   },
 
   ml: {
-    linearRegression: (X: Matrix, y: Vector): Vector =>
-      math.linearRegression(X, y),
+    linearRegression: (
+      X: Matrix,
+      y: Vector,
+      ridge: number = 0,
+      method: RegressionMethod = 'normal'
+    ): Vector => math.linearRegression(X, y, ridge, method),
+    predict: (X: Matrix, coefficients: Vector): Vector =>
+      math.linearRegressionPredict(X, coefficients),
+    createOnlineRegression: (
+      features: number,
+      forgetting: number = 1,
+      ridge: number = 0
+    ): OnlineRegression =>
+      math.createOnlineRegression(features, forgetting, ridge),
+    createNeuralNetwork: (layers: DenseLayer[]): NeuralNetwork =>
+      math.createNeuralNetwork(layers),
+  },
+
+  // Zero-copy variants reading Float64Array/ArrayBuffer memory directly.
+  // Results are written into `out` when given, otherwise freshly allocated.
+  buffer: {
+    vector: {
+      dot: (a: Float64Input, b: Float64Input): number =>
+        math.vectorDotProductBuffer(toBuffer(a), toBuffer(b)),
+      norm: (v: Float64Input, p: number = 2): number =>
+        math.vectorNormBuffer(toBuffer(v), p),
+      sum: (v: Float64Input): number => math.vectorSumBuffer(toBuffer(v)),
+      add: (a: Float64Input, b: Float64Input, out?: Float64Input) =>
+        new Float64Array(
+          math.vectorAddBuffer(toBuffer(a), toBuffer(b), toOutBuffer(out))
+        ),
+      sub: (a: Float64Input, b: Float64Input, out?: Float64Input) =>
+        new Float64Array(
+          math.vectorSubtractBuffer(toBuffer(a), toBuffer(b), toOutBuffer(out))
+        ),
+      scale: (v: Float64Input, s: number, out?: Float64Input) =>
+        new Float64Array(
+          math.vectorScaleBuffer(toBuffer(v), s, toOutBuffer(out))
+        ),
+      // `out` may be `v` itself to map in place
+      map: (fn: ElementwiseFunction, v: Float64Input, out?: Float64Input) =>
+        new Float64Array(
+          math.vectorMapBuffer(fn, toBuffer(v), toOutBuffer(out))
+        ),
+      pow: (v: Float64Input, exponent: number, out?: Float64Input) =>
+        new Float64Array(
+          math.vectorPowBuffer(toBuffer(v), exponent, toOutBuffer(out))
+        ),
+    },
+    matrix: {
+      mul: (
+        a: Float64Input,
+        b: Float64Input,
+        rows: number,
+        inner: number,
+        cols: number,
+        out?: Float64Input
+      ) =>
+        new Float64Array(
+          math.matrixMultiplyBuffer(
+            toBuffer(a),
+            toBuffer(b),
+            rows,
+            inner,
+            cols,
+            toOutBuffer(out)
+          )
+        ),
+      transpose: (
+        m: Float64Input,
+        rows: number,
+        cols: number,
+        out?: Float64Input
+      ) =>
+        new Float64Array(
+          math.matrixTransposeBuffer(toBuffer(m), rows, cols, toOutBuffer(out))
+        ),
+    },
+    signal: {
+      fft: (
+        real: Float64Input,
+        imag: Float64Input,
+        outReal?: Float64Input,
+        outImag?: Float64Input
+      ): [Float64Array, Float64Array] => {
+        const [re, im] = math.fftBuffer(
+          toBuffer(real),
+          toBuffer(imag),
+          toOutBuffer(outReal),
+          toOutBuffer(outImag)
+        )
+        return [new Float64Array(re), new Float64Array(im)]
+      },
+      rfft: (
+        signal: Float64Input,
+        outReal?: Float64Input,
+        outImag?: Float64Input
+      ): [Float64Array, Float64Array] => {
+        const [re, im] = math.rfftBuffer(
+          toBuffer(signal),
+          toOutBuffer(outReal),
+          toOutBuffer(outImag)
+        )
+        return [new Float64Array(re), new Float64Array(im)]
+      },
+      irfft: (
+        real: Float64Input,
+        imag: Float64Input,
+        size?: number,
+        out?: Float64Input
+      ) =>
+        new Float64Array(
+          math.irfftBuffer(
+            toBuffer(real),
+            toBuffer(imag),
+            size,
+            toOutBuffer(out)
+          )
+        ),
+      convolve: (
+        signal: Float64Input,
+        kernel: Float64Input,
+        out?: Float64Input,
+        mode: ConvolutionMode = 'auto'
+      ) =>
+        new Float64Array(
+          math.convolveBuffer(
+            toBuffer(signal),
+            toBuffer(kernel),
+            toOutBuffer(out),
+            mode
+          )
+        ),
+    },
+    statistics: {
+      describe: (
+        data: Float64Input,
+        population: boolean = false
+      ): SummaryStatistics => math.describeBuffer(toBuffer(data), population),
+      // `inPlace` saves a native copy by reordering `data` itself; views
+      // that do not span their whole buffer are still copied first
+      quantiles: (
+        data: Float64Input,
+        probabilities: Vector,
+        inPlace: boolean = false
+      ): Vector => math.quantilesBuffer(toBuffer(data), probabilities, inPlace),
+    },
+    ml: {
+      // X is row-major with `features` values per sample
+      linearRegression: (
+        X: Float64Input,
+        y: Float64Input,
+        features: number,
+        ridge: number = 0,
+        method: RegressionMethod = 'normal'
+      ): Vector =>
+        math.linearRegressionBuffer(
+          toBuffer(X),
+          toBuffer(y),
+          features,
+          ridge,
+          method
+        ),
+      predict: (X: Float64Input, coefficients: Vector, out?: Float64Input) =>
+        new Float64Array(
+          math.linearRegressionPredictBuffer(
+            toBuffer(X),
+            coefficients,
+            toOutBuffer(out)
+          )
+        ),
+      // Points are rows of `dimensions` values; pass `seed` for repeatable runs
+      kmeans: (
+        points: Float64Input,
+        dimensions: number,
+        k: number,
+        maxIterations: number = 300,
+        seed?: number
+      ): Clustering =>
+        toClustering(
+          math.kmeansBuffer(
+            toBuffer(points),
+            dimensions,
+            k,
+            maxIterations,
+            seed
+          )
+        ),
+    },
+    // Single-precision variants over Float32Array/ArrayBuffer memory: half
+    // the bridge payload and twice the SIMD lanes of the float64 kernels
+    f32: {
+      vector: {
+        dot: (a: Float32Input, b: Float32Input): number =>
+          math.vectorDotProductBufferF32(toBuffer(a), toBuffer(b)),
+        norm: (v: Float32Input, p: number = 2): number =>
+          math.vectorNormBufferF32(toBuffer(v), p),
+        sum: (v: Float32Input): number => math.vectorSumBufferF32(toBuffer(v)),
+        add: (a: Float32Input, b: Float32Input, out?: Float32Input) =>
+          new Float32Array(
+            math.vectorAddBufferF32(toBuffer(a), toBuffer(b), toOutBuffer(out))
+          ),
+        sub: (a: Float32Input, b: Float32Input, out?: Float32Input) =>
+          new Float32Array(
+            math.vectorSubtractBufferF32(
+              toBuffer(a),
+              toBuffer(b),
+              toOutBuffer(out)
+            )
+          ),
+        scale: (v: Float32Input, s: number, out?: Float32Input) =>
+          new Float32Array(
+            math.vectorScaleBufferF32(toBuffer(v), s, toOutBuffer(out))
+          ),
+      },
+      matrix: {
+        mul: (
+          a: Float32Input,
+          b: Float32Input,
+          rows: number,
+          inner: number,
+          cols: number,
+          out?: Float32Input
+        ) =>
+          new Float32Array(
+            math.matrixMultiplyBufferF32(
+              toBuffer(a),
+              toBuffer(b),
+              rows,
+              inner,
+              cols,
+              toOutBuffer(out)
+            )
+          ),
+      },
+      signal: {
+        fft: (
+          real: Float32Input,
+          imag: Float32Input,
+          outReal?: Float32Input,
+          outImag?: Float32Input
+        ): [Float32Array, Float32Array] => {
+          const [re, im] = math.fftBufferF32(
+            toBuffer(real),
+            toBuffer(imag),
+            toOutBuffer(outReal),
+            toOutBuffer(outImag)
+          )
+          return [new Float32Array(re), new Float32Array(im)]
+        },
+        rfft: (
+          signal: Float32Input,
+          outReal?: Float32Input,
+          outImag?: Float32Input
+        ): [Float32Array, Float32Array] => {
+          const [re, im] = math.rfftBufferF32(
+            toBuffer(signal),
+            toOutBuffer(outReal),
+            toOutBuffer(outImag)
+          )
+          return [new Float32Array(re), new Float32Array(im)]
+        },
+        irfft: (
+          real: Float32Input,
+          imag: Float32Input,
+          size?: number,
+          out?: Float32Input
+        ) =>
+          new Float32Array(
+            math.irfftBufferF32(
+              toBuffer(real),
+              toBuffer(imag),
+              size,
+              toOutBuffer(out)
+            )
+          ),
+        convolve: (
+          signal: Float32Input,
+          kernel: Float32Input,
+          out?: Float32Input,
+          mode: ConvolutionMode = 'auto'
+        ) =>
+          new Float32Array(
+            math.convolveBufferF32(
+              toBuffer(signal),
+              toBuffer(kernel),
+              toOutBuffer(out),
+              mode
+            )
+          ),
+      },
+    },
+  },
+
+  // Promise-returning variants computed on a native background queue.
+  // Buffer inputs are copied up front and may be reused right away.
+  async: {
+    matrix: {
+      mul: (a: Matrix, b: Matrix): Promise<Matrix> =>
+        math.matrixMultiplyAsync(a, b),
+      inv: (m: Matrix): Promise<Matrix> => math.matrixInverseAsync(m),
+      solve: (A: Matrix, b: Vector): Promise<Vector> =>
+        math.matrixSolveAsync(A, b),
+    },
+    signal: {
+      fft: (real: Vector, imag: Vector): Promise<[Vector, Vector]> =>
+        math.fftAsync(real, imag),
+      ifft: (real: Vector, imag: Vector): Promise<[Vector, Vector]> =>
+        math.ifftAsync(real, imag),
+      rfft: (signal: Vector): Promise<[Vector, Vector]> =>
+        math.rfftAsync(signal),
+      convolve: (
+        signal: Vector,
+        kernel: Vector,
+        mode: ConvolutionMode = 'auto'
+      ): Promise<Vector> => math.convolveAsync(signal, kernel, mode),
+    },
+    ml: {
+      linearRegression: (
+        X: Matrix,
+        y: Vector,
+        ridge: number = 0,
+        method: RegressionMethod = 'normal'
+      ): Promise<Vector> => math.linearRegressionAsync(X, y, ridge, method),
+    },
+    buffer: {
+      matrix: {
+        mul: async (
+          a: Float64Input,
+          b: Float64Input,
+          rows: number,
+          inner: number,
+          cols: number
+        ): Promise<Float64Array> =>
+          new Float64Array(
+            await math.matrixMultiplyBufferAsync(
+              toBuffer(a),
+              toBuffer(b),
+              rows,
+              inner,
+              cols
+            )
+          ),
+      },
+      signal: {
+        convolve: async (
+          signal: Float64Input,
+          kernel: Float64Input,
+          mode: ConvolutionMode = 'auto'
+        ): Promise<Float64Array> =>
+          new Float64Array(
+            await math.convolveBufferAsync(
+              toBuffer(signal),
+              toBuffer(kernel),
+              mode
+            )
+          ),
+      },
+      ml: {
+        kmeans: async (
+          points: Float64Input,
+          dimensions: number,
+          k: number,
+          maxIterations: number = 300,
+          seed?: number
+        ): Promise<Clustering> =>
+          toClustering(
+            await math.kmeansBufferAsync(
+              toBuffer(points),
+              dimensions,
+              k,
+              maxIterations,
+              seed
+            )
+          ),
+      },
+    },
+    // Rejects queued calls that have not started, returns how many
+    cancelPending: (): number => math.cancelPendingTasks(),
   },
 
   utils: {
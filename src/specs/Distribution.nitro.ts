@@ -0,0 +1,62 @@
+// src/specs/Distribution.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector } from './Math.nitro'
+import type { RandomGenerator } from './RandomGenerator.nitro'
+
+// Parameters, in order (defaults in brackets):
+//   normal       mean [0], stddev [1]
+//   lognormal    mu [0], sigma [1] of the underlying normal
+//   exponential  rate [1]
+//   gamma        shape, scale [1]
+//   beta         alpha, beta
+//   studentT     degrees of freedom
+//   chiSquared   degrees of freedom
+//   poisson      lambda
+//   binomial     trials, success probability
+export type DistributionKind =
+  | 'normal'
+  | 'lognormal'
+  | 'exponential'
+  | 'gamma'
+  | 'beta'
+  | 'studentT'
+  | 'chiSquared'
+  | 'poisson'
+  | 'binomial'
+
+// A distribution with validated parameters, see `Math.createDistribution`.
+// Every method works on a whole array in one native call. For poisson and
+// binomial, pdf is the probability mass and quantile(p) is the smallest
+// integer k with cdf(k) >= p. Upper-tail quantiles are solved from the
+// survival function, so p close to 1 keeps its accuracy.
+export interface Distribution
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly kind: DistributionKind
+  // All parameters, defaults filled in
+  readonly params: Vector
+  // NaN or Infinity where the moment does not exist
+  readonly mean: number
+  readonly variance: number
+
+  pdf(x: Vector): Vector
+  cdf(x: Vector): Vector
+  // NaN for p outside [0, 1]
+  quantile(p: Vector): Vector
+
+  // `out` may be the input itself
+  pdfBuffer(x: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+  cdfBuffer(x: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+  quantileBuffer(p: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+
+  // Draws from `generator`, with the same block-parallel streams as its own
+  // uniform and normal methods
+  sample(generator: RandomGenerator, count: number): Vector
+  sampleBuffer(
+    generator: RandomGenerator,
+    count: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+}
@@ -0,0 +1,50 @@
+// src/specs/Expression.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { ElementwiseFunction, Vector } from './Math.nitro'
+
+export type ExpressionOp =
+  | 'input'
+  | 'constant'
+  | 'add'
+  | 'sub'
+  | 'mul'
+  | 'div'
+  | 'min'
+  | 'max'
+  | 'neg'
+  | 'map'
+  | 'pow'
+export type ExpressionReduction = 'sum' | 'mean' | 'min' | 'max' | 'norm'
+
+// One node of an element-wise expression graph. Operands refer to earlier
+// nodes by index and the last node is the result.
+export interface ExpressionNode {
+  op: ExpressionOp
+  // Operand nodes: `a` for 'neg', 'map' and 'pow', both for binary ops
+  a?: number
+  b?: number
+  // Input index for 'input', the value for 'constant', the exponent for 'pow'
+  value?: number
+  // The function for 'map'
+  fn?: ElementwiseFunction
+}
+
+// An element-wise expression compiled once in native memory, see
+// `Math.compileExpression`. Every evaluation is a single fused pass over the
+// inputs with no intermediate arrays.
+export interface Expression
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  // Number of equally long input arrays each call takes
+  readonly inputs: number
+  readonly nodes: number
+
+  evaluate(inputs: Vector[]): Vector
+  // `out` may be one of the inputs
+  evaluateBuffer(inputs: ArrayBuffer[], out?: ArrayBuffer): ArrayBuffer
+  // Reduces the values without materializing them
+  reduce(inputs: Vector[], reduction: ExpressionReduction): number
+  reduceBuffer(inputs: ArrayBuffer[], reduction: ExpressionReduction): number
+}
@@ -0,0 +1,22 @@
+// src/specs/FFTPlan.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector } from './Math.nitro'
+
+// A precomputed FFT of one size and direction, see `Math.createFFTPlan`.
+// Holding on to a plan skips the cache lookup and keeps its tables alive.
+export interface FFTPlan
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly size: number
+  readonly inverse: boolean
+
+  execute(real: Vector, imag: Vector): [Vector, Vector]
+  executeBuffer(
+    real: ArrayBuffer,
+    imag: ArrayBuffer,
+    outReal?: ArrayBuffer,
+    outImag?: ArrayBuffer
+  ): [ArrayBuffer, ArrayBuffer]
+}
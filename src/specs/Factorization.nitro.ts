@@ -0,0 +1,27 @@
+// src/specs/Factorization.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector, Matrix } from './Math.nitro'
+
+// 'lu' for general square matrices, 'cholesky' for symmetric positive
+// definite ones, 'qr' for tall matrices solved in the least-squares sense
+export type FactorizationKind = 'lu' | 'cholesky' | 'qr'
+
+// A matrix factored once in native memory, see `Math.factorize`. Every
+// solve reuses the factors and costs O(n^2) instead of a new O(n^3)
+// decomposition.
+export interface Factorization
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly kind: FactorizationKind
+  readonly rows: number
+  readonly cols: number
+
+  solve(b: Vector): Vector
+  // Solves for every column of B at once, returns a cols x k matrix
+  solveMany(B: Matrix): Matrix
+  // `out` may be `b` itself for square matrices
+  solveBuffer(b: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+  determinant(): number
+}
@@ -0,0 +1,18 @@
+// src/specs/Filter.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector } from './Math.nitro'
+
+// A streaming FIR or biquad IIR filter, see `Math.createFIRFilter` and
+// `Math.createBiquadFilter`. The delay line lives in native memory and is
+// carried from one `process` call to the next, so a stream can be fed in
+// chunks of any size.
+export interface Filter
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  process(chunk: Vector): Vector
+  // `out` may be `chunk` itself to filter in place
+  processBuffer(chunk: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+  reset(): void
+}
@@ -1,9 +1,70 @@
 // src/specs/Math.nitro.ts
 import type { HybridObject } from 'react-native-nitro-modules'
+import type { FFTPlan } from './FFTPlan.nitro'
+import type { Filter } from './Filter.nitro'
+import type {
+  Factorization,
+  FactorizationKind,
+} from './Factorization.nitro'
+import type { OnlineRegression } from './OnlineRegression.nitro'
+import type { DenseLayer, NeuralNetwork } from './NeuralNetwork.nitro'
+import type { Expression, ExpressionNode } from './Expression.nitro'
+import type { DType, NativeArray } from './NativeArray.nitro'
+import type { RandomGenerator } from './RandomGenerator.nitro'
+import type { Distribution, DistributionKind } from './Distribution.nitro'
 
 export type Vector = number[]
 export type Matrix = number[][]
 export type Complex = [number, number]
+// 'auto' picks direct or FFT convolution from the signal and kernel sizes
+export type ConvolutionMode = 'auto' | 'direct' | 'fft' | 'overlapAdd'
+// 'normal' solves the normal equations (fast), 'qr' factors X itself (more
+// accurate for nearly collinear features, but slower and needs a copy of X)
+export type RegressionMethod = 'normal' | 'qr'
+// Functions for the element-wise vectorMap operations
+export type ElementwiseFunction =
+  | 'sin'
+  | 'cos'
+  | 'tan'
+  | 'asin'
+  | 'acos'
+  | 'atan'
+  | 'sinh'
+  | 'cosh'
+  | 'tanh'
+  | 'exp'
+  | 'log'
+  | 'log2'
+  | 'log10'
+  | 'sqrt'
+  | 'abs'
+  | 'erf'
+  | 'erfc'
+  | 'gamma'
+
+export interface KMeansResult {
+  // k rows of `dimensions` float64 values
+  centroids: ArrayBuffer
+  // Cluster index of every point, as int32 values
+  labels: ArrayBuffer
+  // Sum of squared distances from the points to their centroids
+  inertia: number
+  iterations: number
+  // False when maxIterations ran out before the labels settled
+  converged: boolean
+}
+
+// Summary of a sample from one pass over the data. `variance` and
+// `standardDeviation` are sample statistics unless `population` was set.
+export interface SummaryStatistics {
+  count: number
+  sum: number
+  mean: number
+  variance: number
+  standardDeviation: number
+  min: number
+  max: number
+}
 
 export interface Math
   extends HybridObject<{
@@ -68,6 +129,13 @@ export interface Math
   vectorStandardDeviation(vector: Vector, population?: boolean): number
   vectorMin(vector: Vector): number
   vectorMax(vector: Vector): number
+  // fn applied to every element in one call. Out-of-domain values give NaN
+  // or +-Infinity like the scalar functions; nothing throws.
+  vectorMap(fn: ElementwiseFunction, vector: Vector): Vector
+  vectorPow(vector: Vector, exponent: number): Vector
+  // Compiles an element-wise expression graph once; every evaluation then
+  // runs as one fused pass with no intermediate arrays
+  compileExpression(nodes: ExpressionNode[]): Expression
 
   // === MATRIX OPERATIONS ===
   matrixCreate(elements: number[][]): Matrix
@@ -82,33 +150,277 @@ export interface Math
   matrixDeterminant(matrix: Matrix): number
   matrixInverse(matrix: Matrix): Matrix
   matrixTrace(matrix: Matrix): number
+  // Solves A * x = b through an LU factorization of A
+  matrixSolve(A: Matrix, b: Vector): Vector
+  // Factors once for repeated solves, LU by default
+  factorize(matrix: Matrix, kind?: FactorizationKind): Factorization
+
+  // === NATIVE ARRAYS ===
+  // Copy data into native memory once; see NativeArray. dtype defaults to
+  // float64, and `data` holds packed values of that dtype.
+  createNativeArray(
+    data: ArrayBuffer,
+    rows: number,
+    cols: number,
+    dtype?: DType
+  ): NativeArray
+  nativeArrayFromVector(vector: Vector, dtype?: DType): NativeArray
+  nativeArrayFromMatrix(matrix: Matrix, dtype?: DType): NativeArray
+  nativeArrayZeros(rows: number, cols: number, dtype?: DType): NativeArray
 
   // === STATISTICS & PROBABILITY ===
   mean(data: Vector): number
   median(data: Vector): number
+  // Linear interpolation between order statistics (numpy's default), all
+  // probabilities from one selection pass instead of a sort
+  quantiles(data: Vector, probabilities: Vector): Vector
   variance(data: Vector, population?: boolean): number
   standardDeviation(data: Vector, population?: boolean): number
   covariance(a: Vector, b: Vector): number
   correlation(a: Vector, b: Vector): number
+  describe(data: Vector, population?: boolean): SummaryStatistics
 
   // === PROBABILITY DISTRIBUTIONS ===
   normalPDF(x: number, mean?: number, stddev?: number): number
   normalCDF(x: number, mean?: number, stddev?: number): number
+  // Parameters are listed in Distribution.nitro.ts
+  createDistribution(kind: DistributionKind, params?: Vector): Distribution
 
   // === RANDOM NUMBER GENERATION ===
   randomUniform(count: number, min?: number, max?: number): Vector
   randomNormal(count: number, mean?: number, stddev?: number): Vector
+  // Reproducible stream; without a seed one is drawn from the OS
+  createRandomGenerator(seed?: number): RandomGenerator
 
   // === SIGNAL PROCESSING ===
   fft(real: Vector, imag: Vector): [Vector, Vector]
-  convolve(signal: Vector, kernel: Vector): Vector
+  ifft(real: Vector, imag: Vector): [Vector, Vector]
+  // Real-input transforms over the N/2 + 1 non-redundant bins
+  rfft(signal: Vector): [Vector, Vector]
+  irfft(real: Vector, imag: Vector, size?: number): Vector
+  createFFTPlan(size: number, inverse?: boolean): FFTPlan
+  convolve(signal: Vector, kernel: Vector, mode?: ConvolutionMode): Vector
+  // Streaming filters; biquad sections are rows of [b0, b1, b2, a0, a1, a2]
+  createFIRFilter(taps: Vector): Filter
+  createBiquadFilter(sections: Matrix): Filter
 
   // === MACHINE LEARNING ===
-  linearRegression(X: Matrix, y: Vector): Vector
+  // Returns [w_1, ..., w_p, intercept]; `ridge` adds an L2 penalty on w
+  linearRegression(
+    X: Matrix,
+    y: Vector,
+    ridge?: number,
+    method?: RegressionMethod
+  ): Vector
+  linearRegressionPredict(X: Matrix, coefficients: Vector): Vector
+  // Incremental fit; `forgetting` in (0, 1] down-weights older samples
+  createOnlineRegression(
+    features: number,
+    forgetting?: number,
+    ridge?: number
+  ): OnlineRegression
+  // Copies the weights once; layer i + 1 takes layer i's outputs as inputs
+  createNeuralNetwork(layers: DenseLayer[]): NeuralNetwork
 
   // === UTILITIES ===
   factorial(n: number): number
   combinations(n: number, k: number): number
   gcd(a: number, b: number): number
   lcm(a: number, b: number): number
+
+  // === ZERO-COPY BUFFER OPERATIONS ===
+  // Buffers hold packed float64 values (the backing store of a Float64Array)
+  // and are read in place. Methods returning a buffer write into `out` when
+  // given, otherwise they allocate a new one. Matrices are row-major.
+  vectorDotProductBuffer(a: ArrayBuffer, b: ArrayBuffer): number
+  vectorNormBuffer(vector: ArrayBuffer, p?: number): number
+  vectorSumBuffer(vector: ArrayBuffer): number
+  vectorAddBuffer(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  vectorSubtractBuffer(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  vectorScaleBuffer(
+    vector: ArrayBuffer,
+    scalar: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  // `out` may be `vector` itself to map in place
+  vectorMapBuffer(
+    fn: ElementwiseFunction,
+    vector: ArrayBuffer,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  vectorPowBuffer(
+    vector: ArrayBuffer,
+    exponent: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  matrixMultiplyBuffer(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    rows: number,
+    inner: number,
+    cols: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  matrixTransposeBuffer(
+    matrix: ArrayBuffer,
+    rows: number,
+    cols: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  fftBuffer(
+    real: ArrayBuffer,
+    imag: ArrayBuffer,
+    outReal?: ArrayBuffer,
+    outImag?: ArrayBuffer
+  ): [ArrayBuffer, ArrayBuffer]
+  convolveBuffer(
+    signal: ArrayBuffer,
+    kernel: ArrayBuffer,
+    out?: ArrayBuffer,
+    mode?: ConvolutionMode
+  ): ArrayBuffer
+  rfftBuffer(
+    signal: ArrayBuffer,
+    outReal?: ArrayBuffer,
+    outImag?: ArrayBuffer
+  ): [ArrayBuffer, ArrayBuffer]
+  irfftBuffer(
+    real: ArrayBuffer,
+    imag: ArrayBuffer,
+    size?: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  // X holds y.length rows of `features` values
+  linearRegressionBuffer(
+    X: ArrayBuffer,
+    y: ArrayBuffer,
+    features: number,
+    ridge?: number,
+    method?: RegressionMethod
+  ): Vector
+  linearRegressionPredictBuffer(
+    X: ArrayBuffer,
+    coefficients: Vector,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  // k-means with k-means++ seeding over rows of `dimensions` values
+  kmeansBuffer(
+    points: ArrayBuffer,
+    dimensions: number,
+    k: number,
+    maxIterations?: number,
+    seed?: number
+  ): KMeansResult
+  describeBuffer(data: ArrayBuffer, population?: boolean): SummaryStatistics
+  // `inPlace` reorders `data` itself instead of a native copy
+  quantilesBuffer(
+    data: ArrayBuffer,
+    probabilities: Vector,
+    inPlace?: boolean
+  ): Vector
+
+  // === FLOAT32 BUFFER OPERATIONS ===
+  // The buffer operations above over packed float32 values (the backing
+  // store of a Float32Array). Kernels run in single precision with twice the
+  // SIMD lanes; vector reductions still accumulate and return a double.
+  vectorDotProductBufferF32(a: ArrayBuffer, b: ArrayBuffer): number
+  vectorNormBufferF32(vector: ArrayBuffer, p?: number): number
+  vectorSumBufferF32(vector: ArrayBuffer): number
+  vectorAddBufferF32(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  vectorSubtractBufferF32(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  vectorScaleBufferF32(
+    vector: ArrayBuffer,
+    scalar: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  matrixMultiplyBufferF32(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    rows: number,
+    inner: number,
+    cols: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  fftBufferF32(
+    real: ArrayBuffer,
+    imag: ArrayBuffer,
+    outReal?: ArrayBuffer,
+    outImag?: ArrayBuffer
+  ): [ArrayBuffer, ArrayBuffer]
+  convolveBufferF32(
+    signal: ArrayBuffer,
+    kernel: ArrayBuffer,
+    out?: ArrayBuffer,
+    mode?: ConvolutionMode
+  ): ArrayBuffer
+  rfftBufferF32(
+    signal: ArrayBuffer,
+    outReal?: ArrayBuffer,
+    outImag?: ArrayBuffer
+  ): [ArrayBuffer, ArrayBuffer]
+  irfftBufferF32(
+    real: ArrayBuffer,
+    imag: ArrayBuffer,
+    size?: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+
+  // === ASYNC OPERATIONS ===
+  // Same results as the synchronous methods, computed on a native background
+  // queue. Input buffers are copied before the call returns, so they may be
+  // reused immediately. Calls are rejected while the queue is full.
+  matrixMultiplyAsync(a: Matrix, b: Matrix): Promise<Matrix>
+  matrixInverseAsync(matrix: Matrix): Promise<Matrix>
+  matrixSolveAsync(A: Matrix, b: Vector): Promise<Vector>
+  fftAsync(real: Vector, imag: Vector): Promise<[Vector, Vector]>
+  ifftAsync(real: Vector, imag: Vector): Promise<[Vector, Vector]>
+  rfftAsync(signal: Vector): Promise<[Vector, Vector]>
+  convolveAsync(
+    signal: Vector,
+    kernel: Vector,
+    mode?: ConvolutionMode
+  ): Promise<Vector>
+  linearRegressionAsync(
+    X: Matrix,
+    y: Vector,
+    ridge?: number,
+    method?: RegressionMethod
+  ): Promise<Vector>
+  matrixMultiplyBufferAsync(
+    a: ArrayBuffer,
+    b: ArrayBuffer,
+    rows: number,
+    inner: number,
+    cols: number
+  ): Promise<ArrayBuffer>
+  convolveBufferAsync(
+    signal: ArrayBuffer,
+    kernel: ArrayBuffer,
+    mode?: ConvolutionMode
+  ): Promise<ArrayBuffer>
+  kmeansBufferAsync(
+    points: ArrayBuffer,
+    dimensions: number,
+    k: number,
+    maxIterations?: number,
+    seed?: number
+  ): Promise<KMeansResult>
+  // Rejects queued async calls that have not started yet, returns how many
+  cancelPendingTasks(): number
 }
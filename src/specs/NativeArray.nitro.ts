@@ -0,0 +1,67 @@
+// src/specs/NativeArray.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type {
+  ConvolutionMode,
+  ElementwiseFunction,
+  Matrix,
+  Vector,
+} from './Math.nitro'
+
+export type DType = 'float64' | 'float32'
+
+// A row-major rows x cols array that stays in native memory between calls,
+// see `Math.createNativeArray`. Operations return new arrays without copying
+// anything back to JS; call toArray() or toMatrix() when JS needs the values.
+// Vectors are rows x 1 columns.
+export interface NativeArray
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly rows: number
+  readonly cols: number
+  readonly size: number
+  readonly dtype: DType
+  // The native memory itself, not a copy. It can be wrapped in a typed array
+  // or passed to the `*Buffer` methods, and writes show up in the array.
+  readonly buffer: ArrayBuffer
+
+  toArray(): Vector
+  toMatrix(): Matrix
+  clone(): NativeArray
+  astype(dtype: DType): NativeArray
+  // Shares memory with this array
+  reshape(rows: number, cols: number): NativeArray
+  transpose(): NativeArray
+
+  // Element-wise; `other` must have the same shape and dtype
+  add(other: NativeArray): NativeArray
+  sub(other: NativeArray): NativeArray
+  mul(other: NativeArray): NativeArray
+  div(other: NativeArray): NativeArray
+  scale(scalar: number): NativeArray
+  map(fn: ElementwiseFunction): NativeArray
+  pow(exponent: number): NativeArray
+
+  // Matrix product and LU-based solves; float32 solves run in float64
+  matmul(other: NativeArray): NativeArray
+  solve(b: NativeArray): NativeArray
+  inverse(): NativeArray
+
+  // Reductions over all elements, accumulated in float64. sum, mean, min,
+  // max and variance share statistics.describe's one-pass kernel: min and
+  // max skip NaN, and variance is 0 below two elements.
+  dot(other: NativeArray): number
+  norm(): number
+  sum(): number
+  mean(): number
+  min(): number
+  max(): number
+  variance(population?: boolean): number
+
+  // Vector signals. The spectrum is bins x 2 with real and imaginary parts
+  // in the columns.
+  rfft(): NativeArray
+  irfft(size?: number): NativeArray
+  convolve(kernel: NativeArray, mode?: ConvolutionMode): NativeArray
+}
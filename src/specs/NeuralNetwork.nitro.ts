@@ -0,0 +1,31 @@
+// src/specs/NeuralNetwork.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector, Matrix } from './Math.nitro'
+
+export type Activation = 'linear' | 'relu' | 'tanh' | 'sigmoid' | 'softmax'
+
+// Computes activation(x * weights + bias) for every row x of a batch
+export interface DenseLayer {
+  // inputs x outputs
+  weights: Matrix
+  bias: Vector
+  activation: Activation
+}
+
+// A stack of dense layers held in native memory, see
+// `Math.createNeuralNetwork`. Each layer is a single GEMM with the bias and
+// activation fused into it.
+export interface NeuralNetwork
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly inputSize: number
+  readonly outputSize: number
+  readonly layers: number
+
+  // One row per sample, returns one row of outputSize values per sample
+  forward(batch: Matrix): Matrix
+  // Row-major samples of inputSize values each
+  forwardBuffer(batch: ArrayBuffer, out?: ArrayBuffer): ArrayBuffer
+}
@@ -0,0 +1,26 @@
+// src/specs/OnlineRegression.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector, Matrix } from './Math.nitro'
+
+// Linear least-squares fit updated batch by batch, see
+// `Math.createOnlineRegression`. Only the running means and co-moments of
+// the samples are kept, so an update costs O(batch * features^2) no matter
+// how much history came before it.
+export interface OnlineRegression
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  readonly features: number
+  readonly forgetting: number
+  // Sum of the (decayed) sample weights, the sample count without forgetting
+  readonly weight: number
+
+  update(X: Matrix, y: Vector): void
+  // X holds y.length rows of `features` values
+  updateBuffer(X: ArrayBuffer, y: ArrayBuffer): void
+  // [w_1, ..., w_p, intercept]
+  coefficients(): Vector
+  predict(X: Matrix): Vector
+  reset(): void
+}
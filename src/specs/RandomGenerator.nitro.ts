@@ -0,0 +1,36 @@
+// src/specs/RandomGenerator.nitro.ts
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { Vector } from './Math.nitro'
+
+// A seeded xoshiro256++ generator that keeps its state in native memory,
+// see `Math.createRandomGenerator`. The same seed and calls always give the
+// same values. Draws of more than 65536 values are split into independent
+// jump-ahead streams that fill in parallel, with identical output on any
+// number of cores.
+export interface RandomGenerator
+  extends HybridObject<{
+    ios: 'c++'
+    android: 'c++'
+  }> {
+  // Restarts the stream from `seed`, a non-negative integer
+  reseed(seed: number): void
+
+  // Uniform in [min, max), 0 and 1 by default
+  uniform(count: number, min?: number, max?: number): Vector
+  // Ziggurat sampling, standard normal by default
+  normal(count: number, mean?: number, stddev?: number): Vector
+
+  // Fill `out` with `count` float64 values when given, otherwise a new buffer
+  uniformBuffer(
+    count: number,
+    min?: number,
+    max?: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+  normalBuffer(
+    count: number,
+    mean?: number,
+    stddev?: number,
+    out?: ArrayBuffer
+  ): ArrayBuffer
+}